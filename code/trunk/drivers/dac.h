@@ -1,21 +1,42 @@
-/*!
- * \file      dac.h
- * \brief     Internal digital to analogue converter (DAC) controller.
- * \copyright ARM University Program &copy; ARM Ltd 2014.
- */
-#ifndef DAC_H
-#define DAC_H
-
-/*! \brief Initializes the digital to analogue converter, and configures
- *         the appropriate GPIO pin.
- */
-void dac_init(void);
-
-/*! \brief Sets the DAC to a specified code.
- *  \param value Code to set the DAC output to.
- */
-void dac_set(int value);
-
-#endif
-
-// *******************************ARM University Program Copyright © ARM Ltd 2014*************************************   
+/*!
+ * \file      dac.h
+ * \brief     Internal digital to analogue converter (DAC) controller.
+ * \copyright ARM University Program &copy; ARM Ltd 2014.
+ */
+#ifndef DAC_H
+#define DAC_H
+
+#include <stdint.h>
+
+/*! \brief Converts a DAC code to the value written to the DAC register.
+ *  \param n Code to convert.
+ */
+#define DAC_VALUE(n)        ((uint32_t)(((n)&0x3FF)<<6))
+
+/*! \brief Initializes the digital to analogue converter, and configures
+ *         the appropriate GPIO pin.
+ */
+void dac_init(void);
+
+/*! \brief Sets the DAC to a specified code.
+ *  \param value Code to set the DAC output to, between 0 and #DAC_MASK.
+ */
+void dac_set(uint16_t value);
+
+/*! \brief Hands the DAC over to the GPDMA.
+ *
+ *  The DAC's own counter requests a new sample from the GPDMA every \a period
+ *  peripheral clock cycles, and the DAC register is double buffered so that each
+ *  sample appears on the output exactly when the counter times out.
+ *  \param period Sample period in peripheral clock cycles (at most 0xFFFF).
+ */
+void dac_dma_enable(uint32_t period);
+
+/*! \brief Stops the DAC counter and its DMA requests, returning the DAC to
+ *         direct writes through dac_set().
+ */
+void dac_dma_disable(void);
+
+#endif
+
+// *******************************ARM University Program Copyright © ARM Ltd 2014*************************************   
@@ -0,0 +1,179 @@
+#include <platform.h>
+#include <dma.h>
+#include <stddef.h>
+
+//PCONP power control register
+#define PCGPDMA (1UL << 29)
+
+//Global configuration register
+#define DMA_CONFIG_E                  ((uint32_t)(1<<0))
+
+//Channel control register
+#define DMA_CONTROL_SIZE(n)           ((uint32_t)((n)&0xFFF))
+#define DMA_CONTROL_SBSIZE(n)         ((uint32_t)(((n)&0x7)<<12))
+#define DMA_CONTROL_DBSIZE(n)         ((uint32_t)(((n)&0x7)<<15))
+#define DMA_CONTROL_SWIDTH(n)         ((uint32_t)(((n)&0x7)<<18))
+#define DMA_CONTROL_DWIDTH(n)         ((uint32_t)(((n)&0x7)<<21))
+#define DMA_CONTROL_SI                ((uint32_t)(1<<26))
+#define DMA_CONTROL_DI                ((uint32_t)(1<<27))
+#define DMA_CONTROL_I                 ((uint32_t)(1UL<<31))
+
+//Channel configuration register
+#define DMA_CONFIG_ENABLE             ((uint32_t)(1<<0))
+#define DMA_CONFIG_SRC_PERIPH(n)      ((uint32_t)(((n)&0x1F)<<1))
+#define DMA_CONFIG_DST_PERIPH(n)      ((uint32_t)(((n)&0x1F)<<6))
+#define DMA_CONFIG_TYPE(n)            ((uint32_t)(((n)&0x7)<<11))
+#define DMA_CONFIG_IE                 ((uint32_t)(1<<14))
+#define DMA_CONFIG_ITC                ((uint32_t)(1<<15))
+
+//Select channel n
+#define GET_DMA_CHANNEL(n)  ((LPC_GPDMACH_TypeDef*) (LPC_GPDMACH0_BASE + 0x20 * (n)))
+
+static void (*dma_callback)(void) = NULL;
+
+void dma_init(void) {
+	
+	// Enable power
+	LPC_SC -> PCONP |= PCGPDMA;
+	
+	// Clear pending interrupts on all channels
+	LPC_GPDMA -> IntTCClear = 0xFF;
+	LPC_GPDMA -> IntErrClr = 0xFF;
+	
+	// Enable the controller (little-endian)
+	LPC_GPDMA -> Config = DMA_CONFIG_E;
+	while (!(LPC_GPDMA -> Config & DMA_CONFIG_E));
+	
+}
+
+void dma_setup(char ChannelNum, 
+							 unsigned int SrcMemAddr,
+							 unsigned int DstMemAddr,
+							 unsigned int SrcPeriph,
+							 unsigned int DstPeriph,
+							 unsigned int TransferSize,
+							 unsigned int BurstSize,
+							 unsigned int TransferWidth,
+							 unsigned int TransferType,
+							 unsigned int Dmalli  ) {
+	
+	LPC_GPDMACH_TypeDef* ch = GET_DMA_CHANNEL(ChannelNum);
+	uint32_t control = DMA_CONTROL_SIZE(TransferSize) |
+	                   DMA_CONTROL_SBSIZE(BurstSize) | DMA_CONTROL_DBSIZE(BurstSize) |
+	                   DMA_CONTROL_SWIDTH(TransferWidth) | DMA_CONTROL_DWIDTH(TransferWidth) |
+	                   DMA_CONTROL_I;
+	
+	// Memory sides of the transfer are incremented, peripheral sides are not
+	if (TransferType == DMA_M2M || TransferType == DMA_M2P) {
+		control |= DMA_CONTROL_SI;
+	}
+	if (TransferType == DMA_M2M || TransferType == DMA_P2M) {
+		control |= DMA_CONTROL_DI;
+	}
+	
+	dma_disable(ChannelNum);
+	dma_clean(ChannelNum);
+	
+	ch -> CSrcAddr = SrcMemAddr;
+	ch -> CDestAddr = DstMemAddr;
+	ch -> CLLI = Dmalli;
+	ch -> CControl = control;
+	ch -> CConfig = DMA_CONFIG_SRC_PERIPH(SrcPeriph) | DMA_CONFIG_DST_PERIPH(DstPeriph) |
+	                DMA_CONFIG_TYPE(TransferType) | DMA_CONFIG_IE | DMA_CONFIG_ITC;
+	
+}
+
+void dma_link(unsigned char ChannelNum,
+							DmaLli *lli,
+							unsigned int SrcMemAddr,
+							unsigned int DstMemAddr,
+							DmaLli *next) {
+	
+	lli -> SrcAddr = SrcMemAddr;
+	lli -> DstAddr = DstMemAddr;
+	lli -> Next = next;
+	lli -> Control = GET_DMA_CHANNEL(ChannelNum) -> CControl;
+	
+}
+
+void dma_enable(unsigned char ChannelNum) {
+	
+	GET_DMA_CHANNEL(ChannelNum) -> CConfig |= DMA_CONFIG_ENABLE;
+	
+}
+
+void dma_disable(unsigned char ChannelNum) {
+	
+	GET_DMA_CHANNEL(ChannelNum) -> CConfig &= ~DMA_CONFIG_ENABLE;
+	
+}
+
+unsigned int dma_state(unsigned char ChannelNum) {
+	
+	return (LPC_GPDMA -> IntStat >> ChannelNum) & 0x1;
+	
+}
+
+void dma_clean(unsigned char ChannelNum) {
+	
+	LPC_GPDMA -> IntTCClear = (1UL << ChannelNum);
+	LPC_GPDMA -> IntErrClr = (1UL << ChannelNum);
+	
+}
+
+void dma_src_memory(unsigned char ChannelNum, unsigned int address) {
+	
+	GET_DMA_CHANNEL(ChannelNum) -> CSrcAddr = address;
+	
+}
+
+void dma_dest_memory(unsigned char ChannelNum, unsigned int address) {
+	
+	GET_DMA_CHANNEL(ChannelNum) -> CDestAddr = address;
+	
+}
+
+void dma_transfersize(unsigned char ChannelNum, unsigned int size) {
+	
+	LPC_GPDMACH_TypeDef* ch = GET_DMA_CHANNEL(ChannelNum);
+	ch -> CControl = (ch -> CControl & ~DMA_CONTROL_SIZE(0xFFF)) | DMA_CONTROL_SIZE(size);
+	
+}
+
+void dma_link_transfersize(DmaLli *lli, unsigned int size) {
+	
+	lli -> Control = (lli -> Control & ~DMA_CONTROL_SIZE(0xFFF)) | DMA_CONTROL_SIZE(size);
+	
+}
+
+void dma_next_lli(unsigned char ChannelNum, DmaLli *lli) {
+	
+	GET_DMA_CHANNEL(ChannelNum) -> CLLI = (unsigned int)lli;
+	
+}
+
+void dma_set_callback(void (*callback)(void)) {
+	
+	dma_callback = callback;
+	
+	//Enable interrupt for the DMA controller
+	NVIC_SetPriority(DMA_IRQn, 2);
+	NVIC_ClearPendingIRQ(DMA_IRQn);
+	NVIC_EnableIRQ(DMA_IRQn);
+	__enable_irq();
+	
+}
+
+void DMA_IRQHandler(void) {
+	
+	uint32_t status = LPC_GPDMA -> IntStat;
+	
+	if (dma_callback != NULL) {
+		dma_callback();
+	}
+	
+	// Clear interrupts which were pending on entry
+	LPC_GPDMA -> IntTCClear = status;
+	LPC_GPDMA -> IntErrClr = status;
+	
+}
@@ -1,62 +1,118 @@
-/*!
- * \file      dma.h
- * \brief     Controller for DMA pheriperal 
- *            
- * \copyright ARM University Program &copy; ARM Ltd 2014.
- */
-#ifndef DMA_H
-#define DMA_H
-
-
-#define PING 0x00
-#define PONG 0x01
-#define DMA_BUFFER_SIZE 128  
-
-
-/*! \brief Initialises the DMA pheriperal module 
- */
-void dma_init(void);
-
-/*! \brief Setup DMA channel peripheral according to the specified parameters 
- */
-
-void dma_setup(char ChannelNum, 
-							 unsigned int SrcMemAddr,
-							 unsigned int DstMemAddr,
-							 unsigned int SrcPeriph,
-							 unsigned int DstPeriph,
-							 unsigned int TransferSize,
-							 unsigned int BurstSize,
-							 unsigned int TransferWidth,
-							 unsigned int TransferType,
-							 unsigned int Dmalli  );
-
-/*! \brief Enables the DMA chanel. */
-void dma_enable(unsigned char ChannelNum);							 
-
-/*! \brief Disables the DMA chanel. */							 
-void dma_disable(unsigned char ChannelNum);					 
-
-/*! \brief Reads the status of the interrupts
- *  \return 1=DMA channel interrupt request	is active */							 
-unsigned int dma_state(unsigned char ChannelNum);								 
-
-/*! \brief Clean the interrupt requests. */							 
-void dma_clean(unsigned char ChannelNum);		
-
-/*! \brief Rewrite the memory source address */							 
-void dma_src_memory(unsigned char ChannelNum, unsigned int address);		
-
-/*! \brief Rewrite the memory destination address */							 
-void dma_dest_memory(unsigned char ChannelNum, unsigned int address);			
-
-/*! \brief Write the data transfer size. */							 
-void dma_transfersize(unsigned char ChannelNum, unsigned int size);		
-
-/*! \brief Pass a callback to the API, which is executed during the
- *         interrupt handler.
- *  \param callback  Callback function.
- */
-void dma_set_callback(void (*callback)(void));
-
-#endif //DMA_H
+/*!
+ * \file      dma.h
+ * \brief     Controller for DMA pheriperal 
+ *            
+ * \copyright ARM University Program &copy; ARM Ltd 2014.
+ */
+#ifndef DMA_H
+#define DMA_H
+
+
+#define PING 0x00
+#define PONG 0x01
+#define DMA_BUFFER_SIZE 128  
+
+//Transfer widths
+#define DMA_WIDTH_BYTE     0
+#define DMA_WIDTH_HALFWORD 1
+#define DMA_WIDTH_WORD     2
+
+//Burst sizes
+#define DMA_BURST_1        0
+#define DMA_BURST_4        1
+#define DMA_BURST_8        2
+
+//Transfer types (flow control by the DMA controller)
+#define DMA_M2M            0
+#define DMA_M2P            1
+#define DMA_P2M            2
+#define DMA_P2P            3
+
+//Request line of the DAC (see UM10562 Table 692)
+#define DMA_PERIPH_DAC     9
+
+/*! \brief Linked list item describing a transfer which the DMA channel
+ *         loads once its current transfer completes.
+ */
+typedef struct DmaLli {
+	unsigned int SrcAddr;     //!< Source address of the transfer.
+	unsigned int DstAddr;     //!< Destination address of the transfer.
+	struct DmaLli *Next;      //!< Next item in the list, or NULL to stop.
+	unsigned int Control;     //!< Value loaded into the channel's control register.
+} DmaLli;
+
+
+/*! \brief Initialises the DMA pheriperal module 
+ */
+void dma_init(void);
+
+/*! \brief Setup DMA channel peripheral according to the specified parameters 
+ */
+
+void dma_setup(char ChannelNum, 
+							 unsigned int SrcMemAddr,
+							 unsigned int DstMemAddr,
+							 unsigned int SrcPeriph,
+							 unsigned int DstPeriph,
+							 unsigned int TransferSize,
+							 unsigned int BurstSize,
+							 unsigned int TransferWidth,
+							 unsigned int TransferType,
+							 unsigned int Dmalli  );
+
+/*! \brief Fills a linked list item using the transfer settings of a channel.
+ *
+ * The channel must already have been configured using dma_setup().
+ *  \param ChannelNum Channel whose transfer settings are copied.
+ *  \param lli Linked list item to fill.
+ *  \param SrcMemAddr Source address of the transfer.
+ *  \param DstMemAddr Destination address of the transfer.
+ *  \param next Item loaded after this one completes, or NULL.
+ */
+void dma_link(unsigned char ChannelNum,
+							DmaLli *lli,
+							unsigned int SrcMemAddr,
+							unsigned int DstMemAddr,
+							DmaLli *next);
+
+/*! \brief Enables the DMA chanel. */
+void dma_enable(unsigned char ChannelNum);							 
+
+/*! \brief Disables the DMA chanel. */							 
+void dma_disable(unsigned char ChannelNum);					 
+
+/*! \brief Reads the status of the interrupts
+ *  \return 1=DMA channel interrupt request	is active */							 
+unsigned int dma_state(unsigned char ChannelNum);								 
+
+/*! \brief Clean the interrupt requests. */							 
+void dma_clean(unsigned char ChannelNum);		
+
+/*! \brief Rewrite the memory source address */							 
+void dma_src_memory(unsigned char ChannelNum, unsigned int address);		
+
+/*! \brief Rewrite the memory destination address */							 
+void dma_dest_memory(unsigned char ChannelNum, unsigned int address);			
+
+/*! \brief Write the data transfer size. */							 
+void dma_transfersize(unsigned char ChannelNum, unsigned int size);		
+
+/*! \brief Rewrite the data transfer size of a linked list item.
+ *  \param lli Linked list item, which must not have been loaded by its channel yet.
+ *  \param size Number of transfers, between 1 and #DMA_BUFFER_SIZE.
+ */
+void dma_link_transfersize(DmaLli *lli, unsigned int size);
+/*! \brief Rewrite the linked list item which the channel loads once its current transfer completes.
+ *
+ * The channel must be disabled, as this register cannot be changed safely while it runs.
+ *  \param lli Next item, or NULL to stop the channel after its current transfer.
+ */
+void dma_next_lli(unsigned char ChannelNum, DmaLli *lli);
+
+/*! \brief Pass a callback to the API, which is executed during the
+ *         interrupt handler.
+ *  \param callback  Callback function.
+ */
+void dma_set_callback(void (*callback)(void));
+
+#endif //DMA_H
@@ -1,101 +1,205 @@
-#include <platform.h>
-#include <timer.h>
-#include <stddef.h>
-
-//PCONP power control register
-#define PCTIM0 (1UL << 1)
-#define PCTIM1 (1UL << 2)
-#define PCTIM2 (1UL << 22)
-#define PCTIM3 (1UL << 23)
-
-//Increment timer 0 every 100uS
-#define PRESCALEVALUE                   (100)
-//Interrupt triggered every n second
-#define MATCHVALUE(n)                   (10000*n)
-//Set Match Register n
-#define TIM_MCR_CHANNEL_SET(n)      ((uint32_t)(3<<(n*3)))
-//Set Match Register n
-#define TIM_MCR_CHANNEL_SET_ONE_SHOT(n)      ((uint32_t)(7<<(n*3)))
-
-
-static void (*timer_callback)(void) = NULL;
-static void (*timer_delay_callback)(void) = NULL;
-
-static void timer_delay_callback_isr(void);
-
-//Using timer 0
-void timer_init(uint32_t period) {
-	
-	// Enable power
-	LPC_SC -> PCONP |= PCTIM0;
-	
-	//Set to timer default mode
-	LPC_TIM0 -> CTCR = 0;
-  LPC_TIM0 -> TC =0;
-  LPC_TIM0 -> PC =0;
-  LPC_TIM0 -> PR =0;		
-  LPC_TIM0->TCR |= (1<<1);  //Reset Counter
-  LPC_TIM0->TCR &= ~(1<<1); //release reset
-	
-  // Initialize timer 0
-	LPC_TIM0 -> PR = period/4;  //By default PCLK/4
-	// Clear interrupt pending
-	LPC_TIM0 -> IR = 0xFFFFFFFF;
-			
-}
-
-void timer_enable(void) {
-	
-	LPC_TIM0 -> TCR |= 1;
-  LPC_TIM0 -> PC =0;   //the offest of timer is 12 - 13
-	
-}
-
-void timer_disable(void) {
-	
-  LPC_TIM0 -> TCR = 0;
-	
-}
-
-void timer_set_callback(void (*callback)(void), uint32_t period) {
-	
-	timer_callback = callback;
-	
-	//Set Match 0 register
-  LPC_TIM0 -> MR0 = 1;
-	LPC_TIM0 -> MCR |= TIM_MCR_CHANNEL_SET(0);
-	
-	//Enable interrupt for timer 0
-  NVIC_SetPriority(TIMER0_IRQn, 2);
-	NVIC_ClearPendingIRQ(TIMER0_IRQn);
-  NVIC_EnableIRQ(TIMER0_IRQn);
-	__enable_irq();
-
-	timer_init(period);
-	timer_enable();
-}
-
-static void timer_delay_callback_isr(void) {
-	if (timer_delay_callback != NULL) {
-		// we MUST run timer_disable() before, as timer_delay_callback() may itself enable the timer.
-		timer_disable();
-		timer_callback = NULL;
-		timer_delay_callback();
-	}
-}
-
-void timer_set_callback_delay(void (*callback)(void), uint32_t period) {
-	timer_delay_callback = callback;
-	timer_set_callback(timer_delay_callback_isr, period);
-}
-
-void TIMER0_IRQHandler(void){
-	
-	if ( ((LPC_TIM0 -> IR) & (0x1)) != 0 )
-    {
-			timer_callback();
-			// Clear interrupt pending
-			LPC_TIM0 -> IR = 0x1;
-		}
-	
-} 
+#include <platform.h>
+#include <timer.h>
+#include <stddef.h>
+
+//PCONP power control register
+#define PCTIM0 (1UL << 1)
+#define PCTIM1 (1UL << 2)
+#define PCTIM2 (1UL << 22)
+#define PCTIM3 (1UL << 23)
+
+//Set Match Register n
+#define TIM_MCR_CHANNEL_SET(n)      ((uint32_t)(3<<(n*3)))
+//Set Match Register n
+#define TIM_MCR_CHANNEL_SET_ONE_SHOT(n)      ((uint32_t)(7<<(n*3)))
+
+//TCR Register
+#define TIM_TCR_ENABLE              ((uint32_t)(1<<0))
+#define TIM_TCR_RESET               ((uint32_t)(1<<1))
+
+//MCR bits for Match Register n
+#define TIM_MCR_INTERRUPT(n)        ((uint32_t)(1<<((n)*3)))
+//IR bits of all match channels
+#define TIM_IR_MATCH_ALL            ((uint32_t)((1<<TIMER_MATCHES)-1))
+
+//Converts a period in cpu cycles to a number of counter ticks, as the counter runs at PCLK
+#define CYCLES_TO_TICKS(CYCLES) ((CYCLES) / (SystemCoreClock / PeripheralClock))
+
+//Match Register n, which are laid out consecutively
+#define MATCH_REGISTER(n) ((&LPC_TIM0 -> MR0)[n])
+
+static void (*match_callbacks[TIMER_MATCHES])(void);
+//Period (in counter ticks) of each match channel, or 0 if it is a one-shot
+static uint32_t match_periods[TIMER_MATCHES];
+//Match channels whose deadline had already passed when they were set
+static volatile uint32_t match_overdue;
+//Whether timer_configure() has run, as running it again would cancel every channel
+static int configured = 0;
+
+//Using timer 0
+void timer_configure(void) {
+	
+	if (configured) {
+		return;
+	}
+	configured = 1;
+	
+	// Enable power
+	LPC_SC -> PCONP |= PCTIM0;
+	
+	//Timer mode, counting every PCLK cycle, and free-running as matches never reset the counter
+	LPC_TIM0 -> TCR = TIM_TCR_RESET;
+	LPC_TIM0 -> CTCR = 0;
+	LPC_TIM0 -> PR = 0;
+	LPC_TIM0 -> MCR = 0;
+	// Clear interrupt pending
+	LPC_TIM0 -> IR = 0xFFFFFFFF;
+	match_overdue = 0;
+	LPC_TIM0 -> TCR = TIM_TCR_ENABLE;
+	
+	//Enable interrupt for timer 0
+	NVIC_SetPriority(TIMER0_IRQn, 2);
+	NVIC_ClearPendingIRQ(TIMER0_IRQn);
+	NVIC_EnableIRQ(TIMER0_IRQn);
+	__enable_irq();
+	
+}
+
+uint32_t timer_now(void) {
+	
+	return LPC_TIM0 -> TC;
+	
+}
+
+uint32_t timer_match_at(TimerMatch match, void (*callback)(void), uint32_t base, uint32_t delay, uint32_t period) {
+	
+	return timer_match_at_ticks(match, callback, base, CYCLES_TO_TICKS(delay), CYCLES_TO_TICKS(period));
+	
+}
+
+uint32_t timer_match_at_ticks(TimerMatch match, void (*callback)(void), uint32_t base, uint32_t ticks, uint32_t period) {
+	
+	uint32_t primask = __get_PRIMASK();
+	
+	// the interrupt handler must not run between programming the channel and checking whether it was missed.
+	__disable_irq();
+	
+	match_callbacks[match] = callback;
+	match_periods[match] = period;
+	MATCH_REGISTER(match) = base + ticks;
+	LPC_TIM0 -> IR = 1UL << match;
+	match_overdue &= ~(1UL << match);
+	LPC_TIM0 -> MCR |= TIM_MCR_INTERRUPT(match);
+	LPC_TIM0 -> TCR = TIM_TCR_ENABLE;
+	
+	// the counter only matches on the tick it reaches the match value, so a deadline which has already
+	// passed would otherwise take a whole wrap of the counter (over a minute) to fire.
+	if ((uint32_t)(LPC_TIM0 -> TC - base) >= ticks && (LPC_TIM0 -> IR & (1UL << match)) == 0) {
+		match_overdue |= 1UL << match;
+		NVIC_SetPendingIRQ(TIMER0_IRQn);
+	}
+	
+	__set_PRIMASK(primask);
+	
+	return base + ticks;
+	
+}
+
+void timer_match_disable(TimerMatch match) {
+	
+	uint32_t primask = __get_PRIMASK();
+	
+	__disable_irq();
+	LPC_TIM0 -> MCR &= ~TIM_MCR_INTERRUPT(match);
+	LPC_TIM0 -> IR = 1UL << match;
+	match_overdue &= ~(1UL << match);
+	match_callbacks[match] = NULL;
+	__set_PRIMASK(primask);
+	
+}
+
+void timer_rearm(void (*callback)(void), uint32_t period) {
+	
+	timer_match_at(TIMER_MATCH_0, callback, timer_now(), period, period);
+	
+}
+
+void timer_rearm_delay(void (*callback)(void), uint32_t delay) {
+	
+	timer_match_at(TIMER_MATCH_0, callback, timer_now(), delay, 0);
+	
+}
+
+void timer_enable(void) {
+	
+	LPC_TIM0 -> TCR = TIM_TCR_ENABLE;
+	
+}
+
+void timer_disable(void) {
+	
+	LPC_TIM0 -> TCR = 0;
+	LPC_TIM0 -> MCR = 0;
+	LPC_TIM0 -> IR = TIM_IR_MATCH_ALL;
+	match_overdue = 0;
+	
+}
+
+void timer_set_callback(void (*callback)(void), uint32_t period) {
+	
+	timer_configure();
+	timer_rearm(callback, period);
+	
+}
+
+void timer_set_callback_delay(void (*callback)(void), uint32_t delay) {
+	
+	timer_configure();
+	timer_rearm_delay(callback, delay);
+	
+}
+
+void TIMER0_IRQHandler(void){
+	
+	uint32_t pending, late;
+	void (*callback)(void);
+	int match;
+	
+	pending = (LPC_TIM0 -> IR & TIM_IR_MATCH_ALL) | match_overdue;
+	// Clear interrupt pending
+	LPC_TIM0 -> IR = pending & TIM_IR_MATCH_ALL;
+	match_overdue = 0;
+	
+	// channels are serviced in order, so a sample due on the same tick as a deadline is output first.
+	for (match = 0; match < TIMER_MATCHES; match++) {
+		if ((pending & (1UL << match)) == 0 || (LPC_TIM0 -> MCR & TIM_MCR_INTERRUPT(match)) == 0) {
+			continue;
+		}
+		
+		callback = match_callbacks[match];
+		if (match_periods[match] > 0) {
+			// advance from the previous deadline rather than from now, so the interrupt latency does not accumulate.
+			MATCH_REGISTER(match) += match_periods[match];
+			late = LPC_TIM0 -> TC - MATCH_REGISTER(match);
+			if ((int32_t)late >= 0) {
+				// this ran over a period late, and the counter would take a whole wrap to match the deadline
+				// (over a minute), so skip the periods which were missed.
+				MATCH_REGISTER(match) += (late / match_periods[match] + 1) * match_periods[match];
+				if ((int32_t)(LPC_TIM0 -> TC - MATCH_REGISTER(match)) >= 0 && (LPC_TIM0 -> IR & (1UL << match)) == 0) {
+					match_overdue |= 1UL << match;
+					NVIC_SetPendingIRQ(TIMER0_IRQn);
+				}
+			}
+		} else {
+			// one-shot: the callback may itself set this channel again.
+			LPC_TIM0 -> MCR &= ~TIM_MCR_INTERRUPT(match);
+			match_callbacks[match] = NULL;
+		}
+		
+		if (callback != NULL) {
+			callback();
+		}
+	}
+	
+}
+
@@ -1,56 +1,132 @@
-/*!
- * \file      timer.h
- * \brief     Controller for a hardware timer module.
- * \copyright ARM University Program &copy; ARM Ltd 2014.
- */
-#ifndef TIMER_H
-#define TIMER_H
-#include <platform.h>
-#include <stdint.h>
-
-/*! \brief Converts a frequency in Hz to a period in timer cycles.
- *  \param FREQ_HZ Frequency in Hz to convert.
- */
-#define FREQ_HZ_TO_CYCLES(FREQ_HZ) (SystemCoreClock / (FREQ_HZ))
-
-/*! \brief Converts a period in milliseconds to a period in timer cycles.
- * 
- * Note that it is important that the division precedes the multiplication, as otherwise the
- * multiplication will be prone to overflow with the large periods used as arguments to this macro.
- * There is no rounding error, as 1000 divides #SystemCoreClock.
- *
- *  \param PEROD_MS Period in milliseconds to convert.
- */
-#define PERIOD_MS_TO_CYCLES(PERIOD_MS) ((PERIOD_MS) * (SystemCoreClock / 1000U))
-
-/*! \brief Converts a period in seconds to a period in timer cycles.
- *  \param PEROD_S Period in seconds to convert.
- */
-#define PERIOD_S_TO_CYCLES(PERIOD_S) ((PERIOD_S) * SystemCoreClock)
-
-/*! \brief Initialises the timer with a specified period.
- *  \param period  Period of the timer tick (in cpu \a cycles).
- */
-void timer_init(uint32_t period);
-
-/*! \brief Pass a callback to the API, which is executed during the
- *         interrupt handler.
- *  \param callback  Callback function.
- *  \param period Period (in timer cycles) that determines frequency of the timer interrupt.
- */
-void timer_set_callback(void (*callback)(void), uint32_t period);
-
-/*! \brief Pass a callback to the API, which is executed after a delay.
- *  \param delay The delay (in timer cycles) after which the callback is executed.
- */
-void timer_set_callback_delay(void (*callback)(void), uint32_t delay);
-
-/*! \brief Enables the timer operation. */
-void timer_enable(void);
-
-/*! \brief Disables the timer. */
-void timer_disable(void);
-
-#endif // TIMER_H
-
-// *******************************ARM University Program Copyright � ARM Ltd 2014*************************************   
+/*!
+ * \file      timer.h
+ * \brief     Controller for a hardware timer module.
+ * \copyright ARM University Program &copy; ARM Ltd 2014.
+ */
+#ifndef TIMER_H
+#define TIMER_H
+#include <platform.h>
+#include <stdint.h>
+
+/*! \brief Converts a frequency in Hz to a period in timer cycles.
+ *  \param FREQ_HZ Frequency in Hz to convert.
+ */
+#define FREQ_HZ_TO_CYCLES(FREQ_HZ) (SystemCoreClock / (FREQ_HZ))
+
+/*! \brief Converts a period in milliseconds to a period in timer cycles.
+ * 
+ * Note that it is important that the division precedes the multiplication, as otherwise the
+ * multiplication will be prone to overflow with the large periods used as arguments to this macro.
+ * There is no rounding error, as 1000 divides #SystemCoreClock.
+ *
+ *  \param PEROD_MS Period in milliseconds to convert.
+ */
+#define PERIOD_MS_TO_CYCLES(PERIOD_MS) ((PERIOD_MS) * (SystemCoreClock / 1000U))
+
+/*! \brief Converts a period in seconds to a period in timer cycles.
+ *  \param PEROD_S Period in seconds to convert.
+ */
+#define PERIOD_S_TO_CYCLES(PERIOD_S) ((PERIOD_S) * SystemCoreClock)
+
+/*! \brief Converts a period in milliseconds to a number of counter ticks, as read by timer_now().
+ *  \param PERIOD_MS Period in milliseconds to convert.
+ */
+#define PERIOD_MS_TO_TICKS(PERIOD_MS) ((PERIOD_MS) * (PeripheralClock / 1000U))
+
+/*! \brief Match channels of the timer, each of which has its own deadline and callback.
+ *
+ *  The counter is never reset by a match, so deadlines on different channels which are set from
+ *  the same timer_now() reading are exact relative to each other.
+ */
+typedef enum {
+	TIMER_MATCH_0 = 0,
+	TIMER_MATCH_1 = 1,
+	TIMER_MATCH_2 = 2,
+	TIMER_MATCH_3 = 3
+} TimerMatch;
+
+/*! \brief Number of match channels. */
+#define TIMER_MATCHES 4
+
+/*! \brief Powers the timer, starts its counter and sets up its interrupt, with every match channel disabled.
+ *
+ *  This needs to be called before any of the other functions are used. Calling it again has no effect,
+ *  so that each user of the timer can call it without disturbing the channels of the others.
+ */
+void timer_configure(void);
+
+/*! \brief Reads the timer's counter.
+ *  \return The current time, which is only meaningful as the \a base argument of timer_match_at().
+ */
+uint32_t timer_now(void);
+
+/*! \brief Sets a match channel to execute a callback after a delay, and optionally periodically after that.
+ *
+ *  A channel whose deadline has already passed executes its callback as soon as possible.
+ *  Setting a channel replaces its previous deadline and callback.
+ *  \param match  Match channel to set.
+ *  \param callback  Callback function, executed during the interrupt handler.
+ *  \param base  Time (from timer_now()) from which the delay is measured.
+ *  \param delay  The delay (in timer cycles) after which the callback is first executed.
+ *  \param period  Period (in timer cycles) with which the callback is executed after that, or 0 to execute it once.
+ *  \return The time at which the callback is first executed, which can be the base of another deadline.
+ */
+uint32_t timer_match_at(TimerMatch match, void (*callback)(void), uint32_t base, uint32_t delay, uint32_t period);
+
+/*! \brief Same as timer_match_at(), with the delay and period in counter ticks rather than timer cycles.
+ *
+ *  A delay in timer cycles overflows after about 35 s, while one in counter ticks reaches about 71 s.
+ *  \param match  Match channel to set.
+ *  \param callback  Callback function, executed during the interrupt handler.
+ *  \param base  Time (from timer_now()) from which the delay is measured.
+ *  \param ticks  The delay (in counter ticks, see #PERIOD_MS_TO_TICKS) after which the callback is first executed.
+ *  \param period  Period (in counter ticks) with which the callback is executed after that, or 0 to execute it once.
+ *  \return The time at which the callback is first executed, which can be the base of another deadline.
+ */
+uint32_t timer_match_at_ticks(TimerMatch match, void (*callback)(void), uint32_t base, uint32_t ticks, uint32_t period);
+
+/*! \brief Stops a match channel from executing its callback.
+ *  \param match  Match channel to disable.
+ */
+void timer_match_disable(TimerMatch match);
+
+/*! \brief Sets match channel 0 to execute a callback periodically, starting now.
+ *
+ *  Unlike timer_set_callback(), this only writes the match register and the callback,
+ *  so it is cheap enough to be called from the timer's own interrupt handler.
+ *  \param callback  Callback function, executed during the interrupt handler.
+ *  \param period Period (in timer cycles) that determines frequency of the timer interrupt.
+ */
+void timer_rearm(void (*callback)(void), uint32_t period);
+
+/*! \brief Sets match channel 0 to execute a callback once, after a delay.
+ *  \param callback  Callback function, executed during the interrupt handler.
+ *  \param delay The delay (in timer cycles) after which the callback is executed.
+ */
+void timer_rearm_delay(void (*callback)(void), uint32_t delay);
+
+/*! \brief Pass a callback to the API, which is executed during the
+ *         interrupt handler.
+ *
+ *  This also configures the timer if needed, see timer_rearm() for a faster alternative.
+ *  \param callback  Callback function.
+ *  \param period Period (in timer cycles) that determines frequency of the timer interrupt.
+ */
+void timer_set_callback(void (*callback)(void), uint32_t period);
+
+/*! \brief Pass a callback to the API, which is executed after a delay.
+ *
+ *  This also configures the timer if needed, see timer_rearm_delay() for a faster alternative.
+ *  \param delay The delay (in timer cycles) after which the callback is executed.
+ */
+void timer_set_callback_delay(void (*callback)(void), uint32_t delay);
+
+/*! \brief Enables the timer operation. */
+void timer_enable(void);
+
+/*! \brief Disables the timer, and every match channel. */
+void timer_disable(void);
+
+#endif // TIMER_H
+
+// *******************************ARM University Program Copyright � ARM Ltd 2014*************************************   
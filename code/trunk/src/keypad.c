@@ -1,96 +1,361 @@
-#include "keypad.h"
-#include "delay.h"
-#include <platform.h>
-#include <gpio.h>
-#include <stddef.h>
-
-/**
- * \brief Pointer to a function that is called in the read_keypad() code after the column-row combination for the pressed key is obtained
- */
-void (*read_keypad_callback)(int, int) = NULL;
-
-void keypad_set_read_callback(void (*callback)(int, int)) {
-	read_keypad_callback = callback;
-}
-
-/**
- * \brief Reads the keypad for any keypresses
- *
- * The columns are set high and then they are iteratively set to low.
- * For every column set to low, the row pins logic values are read.
- * Every time a low row pin is detected the read_keypad_callback() function is called.
- * The appropriate column pins are set back to high after every row pin has been read.
- *
- * Delays are added after setting the column pins to either low or high to account for debouncing.
- *
- * \param int Bitmask used to verify that the interrupt comes from the set Interrupt pin
- */
-static void read_keypad(int);
-
-void keypad_init(void) {
-	
-	gpio_set_mode(P_COL_0, Output);
-	gpio_set_mode(P_COL_1, Output);
-	gpio_set_mode(P_COL_2, Output);
-	gpio_set_mode(P_COL_3, Output);
-	
-	gpio_set(P_COL_0, 0);
-	gpio_set(P_COL_1, 0);
-	gpio_set(P_COL_2, 0);
-	gpio_set(P_COL_3, 0);
-	delay_us(100);
-	
-	gpio_set_mode(P_ROW_0, PullUp);
-	gpio_set_mode(P_ROW_1, PullUp);
-	gpio_set_mode(P_ROW_2, PullUp);
-	gpio_set_mode(P_ROW_3, PullUp);
-	
-	gpio_set_mode(P_INTERRUPT, PullUp);
-	gpio_set_trigger(P_INTERRUPT, Falling);
-	
-	// sets callback for any pin in this port.
-	gpio_set_callback(P_INTERRUPT, read_keypad);
-}
-
-void read_keypad(int sources) {
-	int col, row;
-	
-	if (!(sources & (1 << GET_PIN_INDEX(P_INTERRUPT)))) {
-		// source of interrupt was not one of the row pins
-		return;
-	}
-	
-	// temporarily disable interrupts on pins.
-	gpio_set_trigger(P_INTERRUPT, None);
-	
-	gpio_set(P_COL_0, 1);
-	gpio_set(P_COL_1, 1);
-	gpio_set(P_COL_2, 1);
-	gpio_set(P_COL_3, 1);
-	delay_us(100);
-	
-	for (col = 0; col < KEYPAD_COLS; col++) {
-		gpio_set(colno_to_pin[col], 0);
-		delay_us(100);
-		
-		for (row = 0; row < KEYPAD_ROWS; row++) {
-			if (gpio_get(rowno_to_pin[row]) == 0) {
-				if (read_keypad_callback != NULL) {
-					read_keypad_callback(row, col);
-				}
-			}
-		}
-		
-		gpio_set(colno_to_pin[col], 1);
-		delay_us(100);
-	}
-	
-	gpio_set(P_COL_0, 0);
-	gpio_set(P_COL_1, 0);
-	gpio_set(P_COL_2, 0);
-	gpio_set(P_COL_3, 0);
-	delay_us(100);
-	
-	// re-enable interrupts on pins.
-	gpio_set_trigger(P_INTERRUPT, Falling);
-}
+#include "keypad.h"
+#include "delay.h"
+#include "timer_wheel.h"
+#include <timer.h>
+#include <platform.h>
+#include <gpio.h>
+#include <stddef.h>
+
+/**
+ * \brief Pointer to a function that is called by keypad_dispatch_events() for every key press
+ */
+void (*read_keypad_callback)(int, int) = NULL;
+
+/**
+ * \brief Pointer to a function that is called by keypad_dispatch_events() for every key event
+ */
+static void (*key_event_callback)(const KeyEvent *) = NULL;
+
+/**
+ * \brief Number of keys on the keypad, which is also the number of bits in a bitmap of keys.
+ */
+#define KEYPAD_KEYS (KEYPAD_ROWS * KEYPAD_COLS)
+
+/**
+ * \brief Time (in ms) given to the keypad lines to settle after the columns are driven, before they are read.
+ */
+#define SCAN_STEP_MS 1
+
+/**
+ * \brief Time (in counter ticks) for which a key must be read the same way for its state to change.
+ */
+#define DEBOUNCE_TICKS PERIOD_MS_TO_TICKS(KEYPAD_DEBOUNCE_MS)
+
+/**
+ * \brief Time (in counter ticks) for which a key must stay down before a #KEY_HOLD event is reported.
+ */
+#define HOLD_TICKS PERIOD_MS_TO_TICKS(KEYPAD_HOLD_MS)
+
+// the counter wraps around after about 71 s.
+#if KEYPAD_DEBOUNCE_MS < 1 || KEYPAD_HOLD_MS > 60000
+#error "KEYPAD_DEBOUNCE_MS or KEYPAD_HOLD_MS is out of range"
+#endif
+
+/**
+ * \brief Integrating debounce filter of each key, in counter ticks.
+ *
+ * Every scan adds the time it took (up to #DEBOUNCE_TICKS) if it reads the key as pressed, and
+ * takes it away (down to 0) if it does not. A key only goes down once its filter reaches
+ * #DEBOUNCE_TICKS, and only goes up once it is back to 0, so bounces between scans cancel out.
+ * Measuring time rather than counting scans keeps the filter right if a scan runs late.
+ */
+static uint32_t key_integrators[KEYPAD_KEYS];
+
+/**
+ * \brief Time (from timer_now()) at which each key which is down went down.
+ */
+static uint32_t key_down_times[KEYPAD_KEYS];
+
+/**
+ * \brief Bitmap (see #KEY_BIT) of the keys which are down, and for which #KEY_HOLD has been reported.
+ */
+static uint16_t keys_held = 0;
+
+/**
+ * \brief Bitmap (see #KEY_BIT) of the keys which are down, after debouncing.
+ */
+static uint16_t keys_down = 0;
+
+/**
+ * \brief Bitmap of the keys whose filter in #key_integrators is not 0.
+ */
+static uint16_t keys_integrating = 0;
+
+/**
+ * \brief Mask which reduces an index modulo #KEY_EVENT_QUEUE_N.
+ */
+#define KEY_EVENT_MASK (KEY_EVENT_QUEUE_N - 1)
+
+/**
+ * \brief Ring buffer of key events, written by the scan and read by keypad_read_event().
+ */
+static KeyEvent key_events[KEY_EVENT_QUEUE_N];
+
+/**
+ * \brief Free-running index of the next event to be read. Only written by the consumer.
+ */
+static volatile unsigned key_events_head = 0;
+
+/**
+ * \brief Free-running index of the next event to be written. Only written by the producer.
+ */
+static volatile unsigned key_events_tail = 0;
+
+/**
+ * \brief Appends a key event to the key event queue, or drops it if the queue is full.
+ *
+ * \param type What happened to the key.
+ * \param key Index of the key (its bit in #keys_down).
+ * \param time Time (from timer_now()) of the scan which completed the change.
+ */
+static void key_event_push(KeyEventType type, int key, uint32_t time);
+
+void keypad_set_read_callback(void (*callback)(int, int)) {
+	read_keypad_callback = callback;
+}
+
+void keypad_set_event_callback(void (*callback)(const KeyEvent *)) {
+	key_event_callback = callback;
+}
+
+static void key_event_push(KeyEventType type, int key, uint32_t time) {
+	unsigned tail = key_events_tail;
+	KeyEvent *event;
+	
+	if (tail - key_events_head == KEY_EVENT_QUEUE_N) {
+		return;
+	}
+	
+	event = &key_events[tail & KEY_EVENT_MASK];
+	event->time = time;
+	event->keys = keys_down;
+	event->type = type;
+	event->row = key / KEYPAD_COLS;
+	event->col = key % KEYPAD_COLS;
+	
+	// the event must be written before the consumer can see it.
+	__DMB();
+	key_events_tail = tail + 1;
+}
+
+bool keypad_read_event(KeyEvent *event) {
+	unsigned head = key_events_head;
+	
+	if (head == key_events_tail) {
+		return false;
+	}
+	
+	// the event must not be read before the tail which published it.
+	__DMB();
+	*event = key_events[head & KEY_EVENT_MASK];
+	__DMB();
+	key_events_head = head + 1;
+	return true;
+}
+
+bool keypad_event_pending(void) {
+	return key_events_head != key_events_tail;
+}
+
+void keypad_dispatch_events(void) {
+	KeyEvent event;
+	
+	while (keypad_read_event(&event)) {
+		if (key_event_callback != NULL) {
+			key_event_callback(&event);
+		}
+		if (event.type == KEY_PRESS && read_keypad_callback != NULL) {
+			read_keypad_callback(event.row, event.col);
+		}
+	}
+}
+
+/**
+ * \brief Column whose rows the next step of the scan reads, or -1 before the first column has been driven.
+ */
+static int scan_col;
+
+/**
+ * \brief Bitmap (see #KEY_BIT) of the keys read as pressed so far by the current scan.
+ */
+static uint16_t scan_keys;
+
+/**
+ * \brief Time (from timer_now()) at which the current scan started.
+ */
+static uint32_t scan_start_time;
+
+/**
+ * \brief Timer which paces the steps of the scan.
+ */
+static SoftTimer scan_timer;
+
+/**
+ * \brief Starts a scan of the keypad when a key is pressed.
+ *
+ * The columns are set high, and the interrupt is disabled until the scan is over. The scan itself
+ * is carried out by scan_step(), so the interrupt returns immediately.
+ *
+ * \param int Bitmask used to verify that the interrupt comes from the set Interrupt pin
+ */
+static void read_keypad(int);
+
+/**
+ * \brief Carries out one step of a scan of the keypad, and schedules the next one.
+ *
+ * Each step reads the row pins of the column driven low by the previous step into #scan_keys,
+ * then sets that column back to high and drives the next one low. This way every column settles
+ * for a whole step without the CPU waiting for it.
+ *
+ * After the last column, the scan is passed through debounce_scan(). The keypad is scanned again
+ * straight away while any key is down or still being filtered. Otherwise all columns are set low
+ * again, and scan_rearm() is called one step later, once they have settled.
+ */
+static void scan_step(void);
+
+/**
+ * \brief Re-enables the keypad interrupt once the scanning has stopped, or scans again if a key
+ * went down in the meantime.
+ */
+static void scan_rearm(void);
+
+/**
+ * \brief Starts scanning the keypad from the first column.
+ */
+static void scan_start(void);
+
+/**
+ * \brief Feeds a complete scan of the keypad through the debounce filters, queueing any key events.
+ *
+ * \param raw Bitmap (see #KEY_BIT) of the keys read as pressed by the scan.
+ * \param now Time (from timer_now()) at which the scan finished.
+ * \param elapsed Time (in counter ticks) taken by the scan.
+ * \return Whether any key is down or still being filtered, so that the keypad needs scanning again.
+ */
+static bool debounce_scan(uint16_t raw, uint32_t now, uint32_t elapsed);
+
+void keypad_init(void) {
+	
+	gpio_set_mode(P_COL_0, Output);
+	gpio_set_mode(P_COL_1, Output);
+	gpio_set_mode(P_COL_2, Output);
+	gpio_set_mode(P_COL_3, Output);
+	
+	gpio_set(P_COL_0, 0);
+	gpio_set(P_COL_1, 0);
+	gpio_set(P_COL_2, 0);
+	gpio_set(P_COL_3, 0);
+	delay_us(100);
+	
+	gpio_set_mode(P_ROW_0, PullUp);
+	gpio_set_mode(P_ROW_1, PullUp);
+	gpio_set_mode(P_ROW_2, PullUp);
+	gpio_set_mode(P_ROW_3, PullUp);
+	
+	gpio_set_mode(P_INTERRUPT, PullUp);
+	gpio_set_trigger(P_INTERRUPT, Falling);
+	
+	// sets callback for any pin in this port.
+	gpio_set_callback(P_INTERRUPT, read_keypad);
+}
+
+void read_keypad(int sources) {
+	if (!(sources & (1 << GET_PIN_INDEX(P_INTERRUPT)))) {
+		// source of interrupt was not one of the row pins
+		return;
+	}
+	
+	// temporarily disable interrupts on pins.
+	gpio_set_trigger(P_INTERRUPT, None);
+	scan_start();
+}
+
+static void scan_start(void) {
+	gpio_set(P_COL_0, 1);
+	gpio_set(P_COL_1, 1);
+	gpio_set(P_COL_2, 1);
+	gpio_set(P_COL_3, 1);
+	
+	scan_col = -1;
+	scan_keys = 0;
+	scan_start_time = timer_now();
+	timer_wheel_schedule(&scan_timer, scan_step, SCAN_STEP_MS);
+}
+
+static void scan_step(void) {
+	uint32_t now;
+	int row;
+	
+	if (scan_col >= 0) {
+		for (row = 0; row < KEYPAD_ROWS; row++) {
+			if (gpio_get(rowno_to_pin[row]) == 0) {
+				scan_keys |= KEY_BIT(row, scan_col);
+			}
+		}
+		
+		gpio_set(colno_to_pin[scan_col], 1);
+	}
+	
+	scan_col++;
+	if (scan_col == KEYPAD_COLS) {
+		now = timer_now();
+		if (!debounce_scan(scan_keys, now, now - scan_start_time)) {
+			gpio_set(P_COL_0, 0);
+			gpio_set(P_COL_1, 0);
+			gpio_set(P_COL_2, 0);
+			gpio_set(P_COL_3, 0);
+			timer_wheel_schedule(&scan_timer, scan_rearm, SCAN_STEP_MS);
+			return;
+		}
+		scan_col = 0;
+		scan_keys = 0;
+		scan_start_time = now;
+	}
+	
+	gpio_set(colno_to_pin[scan_col], 0);
+	timer_wheel_schedule(&scan_timer, scan_step, SCAN_STEP_MS);
+}
+
+static void scan_rearm(void) {
+	if (gpio_get(P_INTERRUPT) == 0) {
+		// a key went down after the last scan, so there will be no falling edge for it.
+		scan_start();
+		return;
+	}
+	
+	// re-enable interrupts on pins.
+	gpio_set_trigger(P_INTERRUPT, Falling);
+}
+
+static bool debounce_scan(uint16_t raw, uint32_t now, uint32_t elapsed) {
+	uint16_t active = raw | keys_down | keys_integrating;
+	uint16_t bit;
+	int key;
+	
+	for (key = 0; key < KEYPAD_KEYS; key++) {
+		bit = 1U << key;
+		if (!(active & bit)) {
+			continue;
+		}
+		
+		if (raw & bit) {
+			key_integrators[key] = DEBOUNCE_TICKS - key_integrators[key] > elapsed ?
+			                       key_integrators[key] + elapsed : DEBOUNCE_TICKS;
+		} else {
+			key_integrators[key] = key_integrators[key] > elapsed ? key_integrators[key] - elapsed : 0;
+		}
+		
+		if (key_integrators[key] > 0) {
+			keys_integrating |= bit;
+		} else {
+			keys_integrating &= ~bit;
+		}
+		
+		if (!(keys_down & bit)) {
+			if (key_integrators[key] == DEBOUNCE_TICKS) {
+				keys_down |= bit;
+				key_down_times[key] = now;
+				key_event_push(KEY_PRESS, key, now);
+			}
+		} else if (key_integrators[key] == 0) {
+			keys_down &= ~bit;
+			keys_held &= ~bit;
+			key_event_push(KEY_RELEASE, key, now);
+		} else if (!(keys_held & bit) && now - key_down_times[key] >= HOLD_TICKS) {
+			keys_held |= bit;
+			key_event_push(KEY_HOLD, key, now);
+		}
+	}
+	
+	return keys_down != 0 || keys_integrating != 0;
+}
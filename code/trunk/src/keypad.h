@@ -1,84 +1,177 @@
-#ifndef KEYPAD_H
-#define KEYPAD_H
-
-#include <platform.h>
-
-/**
- * \brief Macro determining the physical pin used for Column 0
- */
-#define P_COL_0 P1_3
-/**
- * \brief Macro determining the physical pin used for Column 1
- */
-#define P_COL_1	P1_5
-/**
- * \brief Macro determining the physical pin used for Column 2
- */
-#define P_COL_2 P1_6
-/**
- * \brief Macro determining the physical pin used for Column 3
- */
-#define P_COL_3 P1_7
-
-/**
- * \brief Macro determining the physical pin used for Row 0
- */
-#define P_ROW_0 P0_21
-/**
- * \brief Macro determining the physical pin used for Row 1
- */
-#define P_ROW_1 P0_0
-/**
- * \brief Macro determining the physical pin used for Row 2
- */
-#define P_ROW_2 P0_24
-/**
- * \brief Macro determining the physical pin used for Row 3
- */
-#define P_ROW_3 P0_25
-
-/**
- * \brief Macro for the pin that triggers the interrupt on the falling edge
- * 
- * The interrupt triggers the read_keypad() function
- */
-#define P_INTERRUPT P2_10
-
-/**
- * \brief Macro defining the total number of keypad rows
- */
-#define KEYPAD_ROWS 4
-/**
- * \brief Macro defining the total number of keypad columns
- */
-#define KEYPAD_COLS 4
-
-/**
- * \brief Indexes the appropriate column pin using the column position number
- */
-static Pin colno_to_pin[KEYPAD_COLS] = {P_COL_0, P_COL_1, P_COL_2, P_COL_3};
-/**
- * \brief Indexes the appropriate row pin using the row position number
- */
-static Pin rowno_to_pin[KEYPAD_ROWS] = {P_ROW_0, P_ROW_1, P_ROW_2, P_ROW_3};
-
-/**
- * \brief Initializes the keypad driver code
- *
- * The column pins are set as output and low using the gpio_set_mode() and gpio_set() functions
- * The row pins are set as input and are pulled up using the gpio_set_mode() and gpio_set() functions
- * The #P_INTERRUPT pin is pulled up and set as an interrupt pin using the functions gpio_set_mode() gpio_set_trigger()
- * The function called on hardware interrupt is set using the gpio_set_callback() functions
- *
- * \param col The column of the symbol whose tone is to be generated.
- * \param row The row of the symbol whose tone is to be generated.
- */
-void keypad_init(void);
-/**
- * \brief Sets the read_keypad_callback() function which is called in the read_keypad() function
- *
- * \param callback The callback function used to set read_keypad_callback()
- */
-void keypad_set_read_callback(void (*callback)(int, int));
-
-#endif // KEYPAD_H
+#ifndef KEYPAD_H
+#define KEYPAD_H
+
+#include <platform.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * \brief Macro determining the physical pin used for Column 0
+ */
+#define P_COL_0 P1_3
+/**
+ * \brief Macro determining the physical pin used for Column 1
+ */
+#define P_COL_1	P1_5
+/**
+ * \brief Macro determining the physical pin used for Column 2
+ */
+#define P_COL_2 P1_6
+/**
+ * \brief Macro determining the physical pin used for Column 3
+ */
+#define P_COL_3 P1_7
+
+/**
+ * \brief Macro determining the physical pin used for Row 0
+ */
+#define P_ROW_0 P0_21
+/**
+ * \brief Macro determining the physical pin used for Row 1
+ */
+#define P_ROW_1 P0_0
+/**
+ * \brief Macro determining the physical pin used for Row 2
+ */
+#define P_ROW_2 P0_24
+/**
+ * \brief Macro determining the physical pin used for Row 3
+ */
+#define P_ROW_3 P0_25
+
+/**
+ * \brief Macro for the pin that triggers the interrupt on the falling edge
+ * 
+ * The interrupt triggers the read_keypad() function
+ */
+#define P_INTERRUPT P2_10
+
+/**
+ * \brief Macro defining the total number of keypad rows
+ */
+#define KEYPAD_ROWS 4
+/**
+ * \brief Macro defining the total number of keypad columns
+ */
+#define KEYPAD_COLS 4
+
+/**
+ * \brief Time (in ms) for which a key must be read as pressed (or released) before the change is reported.
+ *
+ * The change is reported by the first scan to complete after this time, measured with timer_now().
+ */
+#ifndef KEYPAD_DEBOUNCE_MS
+#define KEYPAD_DEBOUNCE_MS 10
+#endif
+
+/**
+ * \brief Time (in ms) for which a key must be held down before a #KEY_HOLD event is reported.
+ */
+#ifndef KEYPAD_HOLD_MS
+#define KEYPAD_HOLD_MS 800
+#endif
+
+/**
+ * \brief Capacity (in events) of the key event queue. This must be a power of 2.
+ */
+#define KEY_EVENT_QUEUE_N 16
+
+/**
+ * \brief Bit of a key in a bitmap of keys, such as #KeyEvent::keys.
+ *
+ * The bit index is the key's symbol (see dtmf_symbols.h).
+ */
+#define KEY_BIT(ROW, COL) ((uint16_t)(1U << ((ROW) * KEYPAD_COLS + (COL))))
+
+/**
+ * \brief Kinds of key event.
+ */
+typedef enum KeyEventType {
+	KEY_PRESS,      //!< The key went down.
+	KEY_HOLD,       //!< The key has been down for #KEYPAD_HOLD_MS.
+	KEY_RELEASE     //!< The key went up.
+} KeyEventType;
+
+/**
+ * \brief A debounced change in the state of a key.
+ */
+typedef struct KeyEvent {
+	uint32_t time;      //!< Time (from timer_now()) of the scan which completed the change.
+	uint16_t keys;      //!< Bitmap (see #KEY_BIT) of every key down after the change, so that chords can be recognised.
+	uint8_t type;       //!< What happened to the key (a #KeyEventType).
+	uint8_t row;        //!< Row of the key.
+	uint8_t col;        //!< Column of the key.
+} KeyEvent;
+
+/**
+ * \brief Whether a key event happened while other keys were held down.
+ *
+ * \param EVENT The #KeyEvent.
+ */
+#define KEY_EVENT_IS_CHORD(EVENT) \
+	(((EVENT).keys & ~KEY_BIT((EVENT).row, (EVENT).col)) != 0)
+
+/**
+ * \brief Indexes the appropriate column pin using the column position number
+ */
+static Pin colno_to_pin[KEYPAD_COLS] = {P_COL_0, P_COL_1, P_COL_2, P_COL_3};
+/**
+ * \brief Indexes the appropriate row pin using the row position number
+ */
+static Pin rowno_to_pin[KEYPAD_ROWS] = {P_ROW_0, P_ROW_1, P_ROW_2, P_ROW_3};
+
+/**
+ * \brief Initializes the keypad driver code
+ *
+ * The column pins are set as output and low using the gpio_set_mode() and gpio_set() functions
+ * The row pins are set as input and are pulled up using the gpio_set_mode() and gpio_set() functions
+ * The #P_INTERRUPT pin is pulled up and set as an interrupt pin using the functions gpio_set_mode() gpio_set_trigger()
+ * The function called on hardware interrupt is set using the gpio_set_callback() functions
+ *
+ * \param col The column of the symbol whose tone is to be generated.
+ * \param row The row of the symbol whose tone is to be generated.
+ */
+void keypad_init(void);
+/**
+ * \brief Sets the read_keypad_callback() function which is called by keypad_dispatch_events()
+ *
+ * \param callback The callback function used to set read_keypad_callback()
+ */
+void keypad_set_read_callback(void (*callback)(int, int));
+
+/**
+ * \brief Removes the oldest event from the key event queue.
+ *
+ * Key events are queued by the scan from the timer interrupt, so that no key handler runs in
+ * interrupt context. The queue has a single producer (the scan) and a single consumer (the main
+ * loop), and needs no locks. Events which arrive while the queue is full are dropped.
+ *
+ * \param event Struct into which the event is copied.
+ * \return Whether there was an event in the queue.
+ */
+bool keypad_read_event(KeyEvent *event);
+
+/**
+ * \brief Checks whether the key event queue holds any events.
+ *
+ * \return Whether keypad_read_event() would return an event.
+ */
+bool keypad_event_pending(void);
+
+/**
+ * \brief Sets a function which is called by keypad_dispatch_events() for every key event.
+ *
+ * \param callback The function to call, or NULL to only report key presses to read_keypad_callback().
+ */
+void keypad_set_event_callback(void (*callback)(const KeyEvent *));
+
+/**
+ * \brief Reports every event in the key event queue, oldest first.
+ *
+ * #KEY_PRESS events are passed to read_keypad_callback(), and every event is passed to the
+ * callback set by keypad_set_event_callback(). This is meant to be called from the main loop,
+ * whenever an interrupt wakes the CPU.
+ */
+void keypad_dispatch_events(void);
+
+#endif // KEYPAD_H
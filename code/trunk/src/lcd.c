@@ -1,233 +1,316 @@
-#include <platform.h>
-#include <stdint.h>
-#include <gpio.h>
-#include "lcd.h"
-#include "delay.h"
-
-/* Modified for use with LPC4088 experiment bundle;
- * Copyright 2016-2017 Johann A. Briffa
- */
-
-// Pin definitions for serial to parallel converter
-#define PIN_SER  P1_24
-#define PIN_SCK  P1_20
-#define PIN_RCK  P1_2
-
-// Mapping between serial port expander pins and LCD controller
-#define D_LCD_PIN_D4   0
-#define D_LCD_PIN_D5   1
-#define D_LCD_PIN_D6   2
-#define D_LCD_PIN_D7   3
-#define D_LCD_PIN_RS   4
-#define D_LCD_PIN_E    5
-
-// Bitpattern definitions for above
-#define D_LCD_D4       (1<<D_LCD_PIN_D4)
-#define D_LCD_D5       (1<<D_LCD_PIN_D5)
-#define D_LCD_D6       (1<<D_LCD_PIN_D6)
-#define D_LCD_D7       (1<<D_LCD_PIN_D7)
-#define D_LCD_RS       (1<<D_LCD_PIN_RS)
-#define D_LCD_E        (1<<D_LCD_PIN_E)
-
-// *** Internal functions - SPI handler ***
-
-// Internal bus mirror value for serial bus only
-uint8_t _spi_bus;
-
-//Keeps track of where
-static int char_count;
-
-// Low level writes to LCD serial bus only (serial expander)
-void spi_writeBus() {
-	uint8_t c = _spi_bus;
-	int i;
-	for (i = 0; i < 8; i++) {
-		// shift data MSB first.
-		gpio_set(PIN_SER, !!(c & 0x80));
-		// clock data into shift register.
-		delay_us(1);
-		gpio_set(PIN_SCK, 1);
-		delay_us(1);
-		gpio_set(PIN_SCK, 0);
-		// shift the next bit
-		c = c << 1;
-	}
-	// clock data to output latches.
-	delay_us(1);
-	gpio_set(PIN_RCK, 1);
-	delay_us(1);
-	gpio_set(PIN_RCK, 0);
-}
-
-// Initialization
-void spi_init(void) {
-	// set the relevant pins as output
-	gpio_set_mode(PIN_SER, Output);
-	gpio_set_mode(PIN_SCK, Output);
-	gpio_set_mode(PIN_RCK, Output);
-	// set all pins to low
-	gpio_set(PIN_SER, 0);
-	gpio_set(PIN_SCK, 0);
-	gpio_set(PIN_RCK, 0);
-
-	// Init the portexpander bus
-	_spi_bus = 0;
-
-	// write the new data to the portexpander
-	spi_writeBus();
-}
-
-// Set E pin
-void lcd_setEnable(char value) {
-
-	if (value) {
-		_spi_bus |= D_LCD_E;     // Set E bit
-	}
-	else {
-		_spi_bus &= ~D_LCD_E;    // Reset E bit
-	}
-
-  // write the new data to the SPI portexpander
-  spi_writeBus();
-}
-
-// Set RS pin
-void lcd_setRS(char value) {
-
-  if (value) {
-    _spi_bus |= D_LCD_RS;    // Set RS bit
-  }
-  else {
-    _spi_bus &= ~D_LCD_RS;   // Reset RS bit
-  }
-
-  // write the new data to the SPI portexpander
-  spi_writeBus();
-}
-
-// Place the 4bit data on the databus
-void lcd_setData(int value) {
-  int data = value & 0x0F;
-
-  // Set bit by bit to support any mapping of expander portpins to LCD pins
-
-  if (data & 0x01) {
-    _spi_bus |= D_LCD_D4;   // Set Databit
-  }
-  else {
-    _spi_bus &= ~D_LCD_D4;  // Reset Databit
-  }
-
-  if (data & 0x02) {
-    _spi_bus |= D_LCD_D5;   // Set Databit
-  }
-  else {
-    _spi_bus &= ~D_LCD_D5;  // Reset Databit
-  }
-
-  if (data & 0x04) {
-    _spi_bus |= D_LCD_D6;   // Set Databit
-  }
-  else {
-    _spi_bus &= ~D_LCD_D6;  // Reset Databit
-  }
-
-  if (data & 0x08) {
-    _spi_bus |= D_LCD_D7;   // Set Databit
-  }
-  else {
-    _spi_bus &= ~D_LCD_D7;  // Reset Databit
-  }
-
-  // write the new data to the SPI portexpander
-  spi_writeBus();
-}
-
-
-// *** Internal functions - controller interface ***
-
-void lcd_write_4bit(uint8_t c) {
-	lcd_setEnable(1);
-	lcd_setData(c & 0x0F);
-	delay_us(1);
-	lcd_setEnable(0);
-	delay_us(1);
-}
-
-static void lcd_write_data(uint8_t c) {
-	lcd_setRS(1);
-	lcd_write_4bit(c>>4);
-	lcd_write_4bit(c);
-}
-
-void lcd_write_cmd(uint8_t c) {
-	lcd_setRS(0);
-	lcd_write_4bit(c>>4);
-	lcd_write_4bit(c);
-}
-
-// *** Exported functions ***
-
-// Initialises the LCD module.
-void lcd_init(void) {
-	// Set up serial-parallel interface
-	spi_init();
-
-	// Run LCD initilisation sequence
-	lcd_setRS(0);
-	lcd_write_4bit(0x3);
-	delay_us(4100);
-	lcd_write_4bit(0x3);
-	delay_us(100);
-	lcd_write_4bit(0x3);
-	lcd_write_4bit(0x2);
-	lcd_write_cmd(0x28); // Function set.
-	lcd_write_cmd(0x0C);
-	lcd_write_cmd(0x06);
-	char_count = 0;
-	lcd_set_cursor(0, 0);
-}
-
-// Enables or disables visibility of the cursor.
-void lcd_set_cursor_visibile(int visible) {
-	lcd_write_cmd(0x0C | ((!!visible) << 1));
-}
-
-// Moves the cursor position to the specified location.
-void lcd_set_cursor(int column, int row) {
-	int address;
-	address = (row * 0x40) + column;
-	address |= 0x80;
-	char_count = (row << 4) + column;
-	lcd_write_cmd(address);
-}
-
-// Clears the LCD and relocates the cursor to {0,0}.
-void lcd_clear(void) {
-	char_count = 0;
-	lcd_write_cmd(0x01);
-	delay_us(1520);
-}
-
-// Prints the specified character to the LCD and increments the cursor.
-void lcd_put_char(char c) {
-	if (char_count == 32){
-		lcd_clear();
-		lcd_set_cursor(0, 0);
-	}
-	
-	else if (char_count == 16){
-		lcd_set_cursor(0, 1);
-	}
-	lcd_write_data(c);
-	char_count++;
-}
-
-// Prints the null terminated string to the LCD and increments the cursor.
-void lcd_print(char *string) {
-	while(*string) {
-		lcd_put_char(*string++);
-	}
-}
-
-// *******************************ARM University Program Copyright ? ARM Ltd 2014*************************************
+#include <platform.h>
+#include <stdint.h>
+#include <gpio.h>
+#include "lcd.h"
+#include "delay.h"
+#include "timer_wheel.h"
+#include <string.h>
+
+/* Modified for use with LPC4088 experiment bundle;
+ * Copyright 2016-2017 Johann A. Briffa
+ */
+
+// Pin definitions for serial to parallel converter
+#define PIN_SER  P1_24
+#define PIN_SCK  P1_20
+#define PIN_RCK  P1_2
+
+// Mapping between serial port expander pins and LCD controller
+#define D_LCD_PIN_D4   0
+#define D_LCD_PIN_D5   1
+#define D_LCD_PIN_D6   2
+#define D_LCD_PIN_D7   3
+#define D_LCD_PIN_RS   4
+#define D_LCD_PIN_E    5
+
+// Bitpattern definitions for above
+#define D_LCD_D4       (1<<D_LCD_PIN_D4)
+#define D_LCD_D5       (1<<D_LCD_PIN_D5)
+#define D_LCD_D6       (1<<D_LCD_PIN_D6)
+#define D_LCD_D7       (1<<D_LCD_PIN_D7)
+#define D_LCD_RS       (1<<D_LCD_PIN_RS)
+#define D_LCD_E        (1<<D_LCD_PIN_E)
+
+// *** Internal functions - SPI handler ***
+
+// Internal bus mirror value for serial bus only
+uint8_t _spi_bus;
+
+// Dimensions of the display, in character cells
+#define LCD_COLUMNS    16
+#define LCD_ROWS       2
+#define LCD_CELLS      (LCD_COLUMNS * LCD_ROWS)
+
+// DDRAM address of a cell, as rows start at multiples of 0x40
+#define CELL_ADDRESS(cell) ((((cell) / LCD_COLUMNS) * 0x40) + ((cell) % LCD_COLUMNS))
+
+//Keeps track of where the next character goes, as a cell index
+static int char_count;
+
+// Shadow framebuffer, which the exported functions write instead of the controller
+static char shadow[LCD_CELLS];
+
+// Contents of the display, as last written by lcd_step()
+static char displayed[LCD_CELLS];
+
+// DDRAM address the controller's address counter points at, or -1 if unknown
+static int lcd_address;
+
+// Cursor visibility requested through lcd_set_cursor_visibile(), and as last written by lcd_step()
+static int cursor_visible;
+static int displayed_cursor_visible;
+
+// Time (in ms) between two commands sent to the controller. One timer wheel tick is far longer
+// than the 37 us the controller takes to execute a write, so no command ever waits for the last.
+#define LCD_STEP_MS 1
+
+// Paces the writes of lcd_step(), which runs while lcd_busy is set
+static SoftTimer lcd_timer;
+static volatile int lcd_busy;
+
+static void lcd_step(void);
+static void lcd_flush(void);
+
+// Low level writes to LCD serial bus only (serial expander)
+// The shift register needs pulses of some 25 ns, and each gpio_set() takes longer than that,
+// so the pins are toggled back to back.
+void spi_writeBus() {
+	uint8_t c = _spi_bus;
+	int i;
+	for (i = 0; i < 8; i++) {
+		// shift data MSB first.
+		gpio_set(PIN_SER, !!(c & 0x80));
+		// clock data into shift register.
+		gpio_set(PIN_SCK, 1);
+		gpio_set(PIN_SCK, 0);
+		// shift the next bit
+		c = c << 1;
+	}
+	// clock data to output latches.
+	gpio_set(PIN_RCK, 1);
+	gpio_set(PIN_RCK, 0);
+}
+
+// Initialization
+void spi_init(void) {
+	// set the relevant pins as output
+	gpio_set_mode(PIN_SER, Output);
+	gpio_set_mode(PIN_SCK, Output);
+	gpio_set_mode(PIN_RCK, Output);
+	// set all pins to low
+	gpio_set(PIN_SER, 0);
+	gpio_set(PIN_SCK, 0);
+	gpio_set(PIN_RCK, 0);
+
+	// Init the portexpander bus
+	_spi_bus = 0;
+
+	// write the new data to the portexpander
+	spi_writeBus();
+}
+
+// Set E pin
+void lcd_setEnable(char value) {
+
+	if (value) {
+		_spi_bus |= D_LCD_E;     // Set E bit
+	}
+	else {
+		_spi_bus &= ~D_LCD_E;    // Reset E bit
+	}
+
+  // write the new data to the SPI portexpander
+  spi_writeBus();
+}
+
+// Set RS pin
+void lcd_setRS(char value) {
+
+  if (value) {
+    _spi_bus |= D_LCD_RS;    // Set RS bit
+  }
+  else {
+    _spi_bus &= ~D_LCD_RS;   // Reset RS bit
+  }
+
+  // write the new data to the SPI portexpander
+  spi_writeBus();
+}
+
+// Place the 4bit data on the databus
+void lcd_setData(int value) {
+  int data = value & 0x0F;
+
+  // Set bit by bit to support any mapping of expander portpins to LCD pins
+
+  if (data & 0x01) {
+    _spi_bus |= D_LCD_D4;   // Set Databit
+  }
+  else {
+    _spi_bus &= ~D_LCD_D4;  // Reset Databit
+  }
+
+  if (data & 0x02) {
+    _spi_bus |= D_LCD_D5;   // Set Databit
+  }
+  else {
+    _spi_bus &= ~D_LCD_D5;  // Reset Databit
+  }
+
+  if (data & 0x04) {
+    _spi_bus |= D_LCD_D6;   // Set Databit
+  }
+  else {
+    _spi_bus &= ~D_LCD_D6;  // Reset Databit
+  }
+
+  if (data & 0x08) {
+    _spi_bus |= D_LCD_D7;   // Set Databit
+  }
+  else {
+    _spi_bus &= ~D_LCD_D7;  // Reset Databit
+  }
+
+  // write the new data to the SPI portexpander
+  spi_writeBus();
+}
+
+
+// *** Internal functions - controller interface ***
+
+// E stays high for a whole expander write, well over the 450 ns the controller needs.
+void lcd_write_4bit(uint8_t c) {
+	lcd_setEnable(1);
+	lcd_setData(c & 0x0F);
+	lcd_setEnable(0);
+}
+
+static void lcd_write_data(uint8_t c) {
+	lcd_setRS(1);
+	lcd_write_4bit(c>>4);
+	lcd_write_4bit(c);
+}
+
+void lcd_write_cmd(uint8_t c) {
+	lcd_setRS(0);
+	lcd_write_4bit(c>>4);
+	lcd_write_4bit(c);
+}
+
+// *** Exported functions ***
+
+// Initialises the LCD module.
+void lcd_init(void) {
+	// Set up serial-parallel interface
+	spi_init();
+
+	// Run LCD initilisation sequence
+	lcd_setRS(0);
+	lcd_write_4bit(0x3);
+	delay_us(4100);
+	lcd_write_4bit(0x3);
+	delay_us(100);
+	lcd_write_4bit(0x3);
+	lcd_write_4bit(0x2);
+	lcd_write_cmd(0x28); // Function set.
+	lcd_write_cmd(0x0C);
+	lcd_write_cmd(0x06);
+	
+	// Start from a blank display, so that the shadow framebuffer matches it.
+	lcd_write_cmd(0x01);
+	delay_us(1520);
+	memset(shadow, ' ', LCD_CELLS);
+	memset(displayed, ' ', LCD_CELLS);
+	lcd_address = 0;
+	cursor_visible = 0;
+	displayed_cursor_visible = 0;
+	char_count = 0;
+}
+
+// Enables or disables visibility of the cursor.
+void lcd_set_cursor_visibile(int visible) {
+	cursor_visible = !!visible;
+	lcd_flush();
+}
+
+// Moves the cursor position to the specified location.
+void lcd_set_cursor(int column, int row) {
+	char_count = (row << 4) + column;
+	lcd_flush();
+}
+
+// Clears the LCD and relocates the cursor to {0,0}.
+void lcd_clear(void) {
+	char_count = 0;
+	memset(shadow, ' ', LCD_CELLS);
+	lcd_flush();
+}
+
+// Prints the specified character to the LCD and increments the cursor.
+void lcd_put_char(char c) {
+	if (char_count == LCD_CELLS){
+		lcd_clear();
+	}
+	shadow[char_count] = c;
+	char_count++;
+	lcd_flush();
+}
+
+// Prints the null terminated string to the LCD and increments the cursor.
+void lcd_print(char *string) {
+	while(*string) {
+		lcd_put_char(*string++);
+	}
+}
+
+// Sends the controller one command which brings the display closer to the shadow framebuffer.
+// This runs from the timer interrupt, and stops rescheduling itself once the display matches.
+static void lcd_step(void) {
+	int cell, cursor;
+	char c;
+	
+	for (cell = 0; cell < LCD_CELLS && shadow[cell] == displayed[cell]; cell++);
+	
+	if (cell < LCD_CELLS) {
+		// consecutive changed cells only need the cursor moved once.
+		if (lcd_address != CELL_ADDRESS(cell)) {
+			lcd_write_cmd(0x80 | CELL_ADDRESS(cell));
+			lcd_address = CELL_ADDRESS(cell);
+		} else {
+			// the shadow may change after this, in which case the cell is written again.
+			c = shadow[cell];
+			lcd_write_data(c);
+			displayed[cell] = c;
+			lcd_address = CELL_ADDRESS(cell) + 1;
+		}
+	} else if (cursor_visible != displayed_cursor_visible) {
+		displayed_cursor_visible = cursor_visible;
+		lcd_write_cmd(0x0C | (displayed_cursor_visible << 1));
+	} else {
+		// the cursor only needs to be in place while it can be seen.
+		cursor = char_count;
+		if (!displayed_cursor_visible || cursor >= LCD_CELLS || lcd_address == CELL_ADDRESS(cursor)) {
+			lcd_busy = 0;
+			return;
+		}
+		lcd_write_cmd(0x80 | CELL_ADDRESS(cursor));
+		lcd_address = CELL_ADDRESS(cursor);
+	}
+	
+	timer_wheel_schedule(&lcd_timer, lcd_step, LCD_STEP_MS);
+}
+
+// Starts sending the shadow framebuffer to the display, unless this is already in progress.
+// A change made while this is in progress is still picked up, as each step reads the shadow again.
+static void lcd_flush(void) {
+	uint32_t primask = __get_PRIMASK();
+	
+	__disable_irq();
+	if (!lcd_busy) {
+		lcd_busy = 1;
+		timer_wheel_schedule(&lcd_timer, lcd_step, LCD_STEP_MS);
+	}
+	__set_PRIMASK(primask);
+}
+
+// *******************************ARM University Program Copyright ? ARM Ltd 2014*************************************
@@ -0,0 +1,544 @@
+#include "queue.h"
+
+/*
+ * Atomic accesses to the words shared between producers and the consumer. FETCH_ADD and
+ * COMPARE_EXCHANGE are only needed by the multi-producer variant, and are sequentially consistent.
+ */
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_ATOMICS__)
+
+#include <stdatomic.h>
+
+typedef atomic_uint queue_word;
+
+#define LOAD_RELAXED(INDEX) atomic_load_explicit(&(INDEX), memory_order_relaxed)
+#define STORE_RELAXED(INDEX, VALUE) atomic_store_explicit(&(INDEX), (VALUE), memory_order_relaxed)
+#define LOAD_ACQUIRE(INDEX) atomic_load_explicit(&(INDEX), memory_order_acquire)
+#define STORE_RELEASE(INDEX, VALUE) atomic_store_explicit(&(INDEX), (VALUE), memory_order_release)
+#define FETCH_ADD(WORD, VALUE) atomic_fetch_add(&(WORD), (VALUE))
+#define COMPARE_EXCHANGE(WORD, EXPECTED, DESIRED) compare_exchange(&(WORD), (EXPECTED), (DESIRED))
+
+/**
+ * \brief Replaces the value of a word, if it holds an expected value.
+ *
+ * \param word The word to update.
+ * \param expected The value which the word must hold.
+ * \param desired The new value of the word.
+ * \return Whether the word was updated.
+ */
+static inline bool compare_exchange(queue_word *word, unsigned expected, unsigned desired) {
+	return atomic_compare_exchange_strong(word, &expected, desired);
+}
+
+#elif defined(__GNUC__) && !defined(__ARMCC_VERSION)
+
+typedef unsigned queue_word;
+
+#define LOAD_RELAXED(INDEX) __atomic_load_n(&(INDEX), __ATOMIC_RELAXED)
+#define STORE_RELAXED(INDEX, VALUE) __atomic_store_n(&(INDEX), (VALUE), __ATOMIC_RELAXED)
+#define LOAD_ACQUIRE(INDEX) __atomic_load_n(&(INDEX), __ATOMIC_ACQUIRE)
+#define STORE_RELEASE(INDEX, VALUE) __atomic_store_n(&(INDEX), (VALUE), __ATOMIC_RELEASE)
+#define FETCH_ADD(WORD, VALUE) __sync_fetch_and_add(&(WORD), (VALUE))
+#define COMPARE_EXCHANGE(WORD, EXPECTED, DESIRED) __sync_bool_compare_and_swap(&(WORD), (EXPECTED), (DESIRED))
+
+#else
+
+// ARMCC 5 has no <stdatomic.h>. Aligned word accesses are single-copy atomic on the Cortex-M4,
+// so only the ordering needs enforcing, with a DMB after an acquire load and before a release store.
+#include <platform.h>
+
+typedef volatile unsigned queue_word;
+
+/**
+ * \brief Reads a queue index, and orders it before any later memory access.
+ *
+ * \param index The index to read.
+ * \return The value of the index.
+ */
+__STATIC_INLINE unsigned load_acquire(queue_word *index) {
+	unsigned value = *index;
+	__DMB();
+	return value;
+}
+
+#define LOAD_RELAXED(INDEX) (INDEX)
+#define STORE_RELAXED(INDEX, VALUE) ((INDEX) = (VALUE))
+#define LOAD_ACQUIRE(INDEX) load_acquire(&(INDEX))
+#define STORE_RELEASE(INDEX, VALUE) do { __DMB(); (INDEX) = (VALUE); } while (0)
+#define FETCH_ADD(WORD, VALUE) __sync_fetch_and_add(&(WORD), (VALUE))
+#define COMPARE_EXCHANGE(WORD, EXPECTED, DESIRED) __sync_bool_compare_and_swap(&(WORD), (EXPECTED), (DESIRED))
+
+#endif
+
+/**
+ * \brief Mask which reduces an index modulo #QUEUE_N.
+ */
+#define QUEUE_MASK (QUEUE_N - 1)
+
+#if QUEUE_MPSC
+
+/*
+ * Producers claim slots by advancing #queue_tail with a compare-and-swap, and the consumer is the
+ * only one to advance #queue_head. Each slot carries a sequence number, which tells whether it is
+ * free for the producer of a position, or holds the command for that position. A slot is handed over
+ * by writing its sequence number with release ordering, and the other side reads it with acquire
+ * ordering before touching the command. The consumer never loops, so dequeue_command() is wait-free.
+ *
+ * For the slot of position p, let lap(p) be p rounded down to a multiple of #QUEUE_N. The slot is
+ * free for p when its sequence number is lap(p), holds the command for p when it is lap(p) + 1,
+ * and is made free for p + #QUEUE_N by the consumer. Since these are all multiples of #QUEUE_N
+ * (plus 1), the zero-initialised queue starts out with every slot free.
+ */
+
+/**
+ * Macro function rounding a queue position down to a multiple of #QUEUE_N.
+ *
+ * @param POSITION The position.
+ */
+#define LAP(POSITION) ((POSITION) & ~(unsigned)QUEUE_MASK)
+
+/**
+ * \brief A slot of the multi-producer queue.
+ */
+typedef struct Slot {
+	queue_word sequence;    //!< Sequence number, which says whether the slot is free or holds a command.
+	Command command;        //!< The command held by the slot.
+} Slot;
+
+/**
+ * \brief Storage of the global command queue.
+ */
+static Slot queue[QUEUE_N];
+
+/**
+ * \brief Position of the front of the queue. Only used by the consumer.
+ */
+static queue_word queue_head;
+
+/**
+ * \brief Position after the last slot claimed by a producer.
+ */
+static queue_word queue_tail;
+
+/**
+ * \brief Counters of the queue, which producers update atomically.
+ */
+static queue_word stat_overflows, stat_drops, stat_high_watermark;
+
+/**
+ * \brief Whether the last values passed to the queue were rejected.
+ *
+ * This lets consecutive rejections count as a single overflow.
+ */
+static queue_word queue_overflowing;
+
+/**
+ * \brief Claims consecutive slots of the queue, updating the counters.
+ *
+ * Slots are freed in order, so a run of slots is free as soon as its last slot is.
+ *
+ * \param n Number of slots to claim.
+ * \param position Where the position of the first slot claimed is written.
+ * \return Whether the slots were claimed.
+ */
+static bool queue_claim(size_t n, unsigned *position) {
+	unsigned tail, last, length, watermark;
+	int lag;
+	
+	do {
+		tail = LOAD_RELAXED(queue_tail);
+		last = tail + n - 1;
+		lag = n > QUEUE_N ? -1 : (int)(LOAD_ACQUIRE(queue[last & QUEUE_MASK].sequence) - LAP(last));
+		if (lag < 0) {
+			// the last slot has not been freed for this lap yet, so the queue is full.
+			if (COMPARE_EXCHANGE(queue_overflowing, 0, 1)) {
+				FETCH_ADD(stat_overflows, 1);
+			}
+			FETCH_ADD(stat_drops, n);
+			return false;
+		}
+		// if lag > 0, another producer has claimed the slot since the tail was read, so try again.
+	} while (lag > 0 || !COMPARE_EXCHANGE(queue_tail, tail, tail + n));
+	STORE_RELAXED(queue_overflowing, 0);
+	
+	// the head may move while this is computed, so the high watermark is only approximate.
+	length = tail + n - LOAD_RELAXED(queue_head);
+	do {
+		watermark = LOAD_RELAXED(stat_high_watermark);
+	} while (length > watermark && !COMPARE_EXCHANGE(stat_high_watermark, watermark, length));
+	
+	*position = tail;
+	return true;
+}
+
+/**
+ * \brief Writes a command into a claimed slot, and hands it over to the consumer.
+ *
+ * \param position The position of the slot.
+ * \param command The command to write.
+ */
+static void queue_publish(unsigned position, const Command *command) {
+	Slot *slot = &queue[position & QUEUE_MASK];
+	
+	slot->command = *command;
+	STORE_RELEASE(slot->sequence, LAP(position) + 1);
+}
+
+bool enqueue_sequence(const uint8_t *symbols, size_t n) {
+	Command command;
+	unsigned position;
+	size_t i;
+	
+	if (n == 0) {
+		return true;
+	}
+	if (!queue_claim(n, &position)) {
+		return false;
+	}
+	
+	command.type = COMMAND_TONE;
+	command.marker = 0;
+	command.length = 0;
+	command.spacing = 0;
+	for (i = 0; i < n; i++) {
+		command.symbol = symbols[i] & 0xF;
+		queue_publish(position + i, &command);
+	}
+	return true;
+}
+
+bool enqueue_commands(const Command *commands, size_t n) {
+	unsigned position;
+	size_t i;
+	
+	if (n == 0) {
+		return true;
+	}
+	if (!queue_claim(n, &position)) {
+		return false;
+	}
+	
+	for (i = 0; i < n; i++) {
+		queue_publish(position + i, &commands[i]);
+	}
+	return true;
+}
+
+bool dequeue_command(Command *command) {
+	unsigned head = LOAD_RELAXED(queue_head);
+	Slot *slot = &queue[head & QUEUE_MASK];
+	
+	if (LOAD_ACQUIRE(slot->sequence) != LAP(head) + 1) {
+		return false;
+	}
+	
+	*command = slot->command;
+	STORE_RELEASE(slot->sequence, LAP(head) + QUEUE_N);
+	STORE_RELAXED(queue_head, head + 1);
+	return true;
+}
+
+void queue_get_stats(QueueStats *stats) {
+	stats->overflows = LOAD_RELAXED(stat_overflows);
+	stats->drops = LOAD_RELAXED(stat_drops);
+	stats->high_watermark = LOAD_RELAXED(stat_high_watermark);
+}
+
+#else
+
+/*
+ * The producer only ever writes #queue_tail and #queue, and the consumer only ever writes #queue_head.
+ * A slot is handed over by publishing the index after it with release ordering, and the
+ * other side reads that index with acquire ordering before touching the slot.
+ *
+ * Several slots share a word of #queue, so the producer may update a word while the consumer
+ * reads another slot in it. Words are therefore always accessed whole, and atomically.
+ */
+
+/**
+ * \brief Number of bits in a queue slot.
+ */
+#define SLOT_BITS 4
+
+/**
+ * \brief Mask which keeps the bits of a value stored in a queue slot.
+ */
+#define SLOT_MASK ((1U << SLOT_BITS) - 1)
+
+/**
+ * \brief Number of slots packed into a word of #queue.
+ */
+#define SLOTS_PER_WORD 8
+
+/**
+ * \brief Storage of the global command queue.
+ *
+ * Each entry is an #Opcode followed by its fields, in consecutive 4-bit slots. Slot i is held in bits `SLOT_BITS * (i % SLOTS_PER_WORD)` and up of word `i / SLOTS_PER_WORD`.
+ */
+static queue_word queue[QUEUE_N / SLOTS_PER_WORD];
+
+/**
+ * \brief Number of slots ever removed from the queue. Only written by the consumer.
+ *
+ * The index of the front of the queue is this modulo #QUEUE_N. Since #QUEUE_N divides 2^32,
+ * this may wrap around freely.
+ */
+static queue_word queue_head;
+
+/**
+ * \brief Number of slots ever appended to the queue. Only written by the producer.
+ */
+static queue_word queue_tail;
+
+/**
+ * \brief Counters of the queue. Only written by the producer.
+ */
+static volatile QueueStats queue_stats;
+
+/**
+ * \brief Whether the last values passed to the queue were rejected. Only used by the producer.
+ *
+ * This lets consecutive rejections count as a single overflow.
+ */
+static bool queue_overflowing;
+
+/**
+ * \brief Number of symbols left in the run which the consumer is reading. Only used by the consumer.
+ */
+static unsigned run_left;
+
+/**
+ * \brief Opcodes which start each entry of the queue, in the first slot of the entry.
+ *
+ * Each is followed by the fields of the entry, in the order listed. Multi-slot fields are stored
+ * least significant slot first.
+ */
+enum Opcode {
+	OP_RUN,         //!< Count - 1 (1 slot), then that many symbols (1 slot each), each played for the current symbol length.
+	OP_TONE,        //!< Symbol (1 slot), then length in ms (4 slots).
+	OP_SILENCE,     //!< Length in ms (4 slots).
+	OP_SET_TIMING,  //!< Symbol length in ms (4 slots), then inter-symbol spacing in ms (4 slots).
+	OP_MARKER       //!< Marker (2 slots).
+};
+
+/**
+ * \brief Maximum number of symbols in an #OP_RUN entry.
+ */
+#define MAX_RUN (SLOT_MASK + 1)
+
+/**
+ * \brief Reserves room in the queue for a number of slots, updating the counters.
+ *
+ * \param tail The current tail of the queue.
+ * \param slots Number of slots to make room for.
+ * \param values Number of values (symbols or commands) held by these slots, counted as drops if there is no room.
+ * \return Whether there is room for all of them.
+ */
+static bool queue_reserve(unsigned tail, unsigned slots, size_t values) {
+	unsigned length = tail - LOAD_ACQUIRE(queue_head);
+	
+	if (slots > QUEUE_N - length) {
+		if (!queue_overflowing) {
+			queue_overflowing = true;
+			queue_stats.overflows++;
+		}
+		queue_stats.drops += values;
+		return false;
+	}
+	queue_overflowing = false;
+	
+	if (length + slots > queue_stats.high_watermark) {
+		queue_stats.high_watermark = length + slots;
+	}
+	return true;
+}
+
+/**
+ * \brief Stores a field in consecutive slots of #queue, without publishing it.
+ *
+ * \param index The index of the first slot (which is reduced modulo #QUEUE_N). This is advanced past the field.
+ * \param value The value of the field.
+ * \param slots Number of slots taken by the field.
+ * \param store Whether to store the field. If false, only \a index is advanced, which is used to measure entries.
+ */
+static void queue_put(unsigned *index, unsigned value, unsigned slots, bool store) {
+	unsigned slot, shift, word;
+	
+	for (; slots > 0; slots--, value >>= SLOT_BITS) {
+		slot = (*index)++ & QUEUE_MASK;
+		if (!store) {
+			continue;
+		}
+		shift = (slot % SLOTS_PER_WORD) * SLOT_BITS;
+		// the consumer never writes to #queue, so the other slots in this word cannot change under us.
+		word = LOAD_RELAXED(queue[slot / SLOTS_PER_WORD]);
+		word = (word & ~(SLOT_MASK << shift)) | ((value & SLOT_MASK) << shift);
+		STORE_RELAXED(queue[slot / SLOTS_PER_WORD], word);
+	}
+}
+
+/**
+ * \brief Loads a field from consecutive slots of #queue.
+ *
+ * \param index The index of the first slot (which is reduced modulo #QUEUE_N). This is advanced past the field.
+ * \param slots Number of slots taken by the field.
+ * \return The value of the field.
+ */
+static unsigned queue_get(unsigned *index, unsigned slots) {
+	unsigned slot, value = 0, i;
+	
+	for (i = 0; i < slots; i++) {
+		slot = (*index)++ & QUEUE_MASK;
+		value |= ((LOAD_RELAXED(queue[slot / SLOTS_PER_WORD]) >> ((slot % SLOTS_PER_WORD) * SLOT_BITS)) & SLOT_MASK) << (i * SLOT_BITS);
+	}
+	return value;
+}
+
+/**
+ * \brief Encodes a sequence of symbols as #OP_RUN entries.
+ *
+ * \param index The index of the first slot to use. This is advanced past the entries.
+ * \param symbols The symbols to encode.
+ * \param n Number of symbols to encode.
+ * \param store Whether to store the entries, see queue_put().
+ */
+static void encode_sequence(unsigned *index, const uint8_t *symbols, size_t n, bool store) {
+	size_t run, i;
+	
+	for (; n > 0; n -= run) {
+		run = n < MAX_RUN ? n : MAX_RUN;
+		queue_put(index, OP_RUN, 1, store);
+		queue_put(index, run - 1, 1, store);
+		for (i = 0; i < run; i++) {
+			queue_put(index, *symbols++, 1, store);
+		}
+	}
+}
+
+/**
+ * \brief Encodes a command as an entry of the queue.
+ *
+ * Tones of the current symbol length are encoded as an #OP_RUN of one symbol, which is shorter than an #OP_TONE.
+ *
+ * \param index The index of the first slot to use. This is advanced past the entry.
+ * \param command The command to encode.
+ * \param store Whether to store the entry, see queue_put().
+ */
+static void encode_command(unsigned *index, const Command *command, bool store) {
+	switch (command->type) {
+		case COMMAND_TONE:
+			if (command->length == 0) {
+				encode_sequence(index, &command->symbol, 1, store);
+			} else {
+				queue_put(index, OP_TONE, 1, store);
+				queue_put(index, command->symbol, 1, store);
+				queue_put(index, command->length, 4, store);
+			}
+			break;
+		case COMMAND_SILENCE:
+			queue_put(index, OP_SILENCE, 1, store);
+			queue_put(index, command->length, 4, store);
+			break;
+		case COMMAND_SET_TIMING:
+			queue_put(index, OP_SET_TIMING, 1, store);
+			queue_put(index, command->length, 4, store);
+			queue_put(index, command->spacing, 4, store);
+			break;
+		case COMMAND_MARKER:
+			queue_put(index, OP_MARKER, 1, store);
+			queue_put(index, command->marker, 2, store);
+			break;
+	}
+}
+
+bool enqueue_sequence(const uint8_t *symbols, size_t n) {
+	unsigned tail = LOAD_RELAXED(queue_tail);
+	unsigned end = tail;
+	
+	encode_sequence(&end, symbols, n, false);
+	if (!queue_reserve(tail, end - tail, n)) {
+		return false;
+	}
+	encode_sequence(&tail, symbols, n, true);
+	STORE_RELEASE(queue_tail, tail);
+	return true;
+}
+
+bool enqueue_commands(const Command *commands, size_t n) {
+	unsigned tail = LOAD_RELAXED(queue_tail);
+	unsigned end = tail;
+	size_t i;
+	
+	for (i = 0; i < n; i++) {
+		encode_command(&end, &commands[i], false);
+	}
+	if (!queue_reserve(tail, end - tail, n)) {
+		return false;
+	}
+	for (i = 0; i < n; i++) {
+		encode_command(&tail, &commands[i], true);
+	}
+	STORE_RELEASE(queue_tail, tail);
+	return true;
+}
+
+bool dequeue_command(Command *command) {
+	unsigned head = LOAD_RELAXED(queue_head);
+	
+	if (head == LOAD_ACQUIRE(queue_tail)) {
+		return false;
+	}
+	
+	command->symbol = 0;
+	command->marker = 0;
+	command->length = 0;
+	command->spacing = 0;
+	
+	if (run_left == 0) {
+		switch (queue_get(&head, 1)) {
+			case OP_RUN:
+				run_left = queue_get(&head, 1) + 1;
+				break;
+			case OP_TONE:
+				command->type = COMMAND_TONE;
+				command->symbol = queue_get(&head, 1);
+				command->length = queue_get(&head, 4);
+				break;
+			case OP_SILENCE:
+				command->type = COMMAND_SILENCE;
+				command->length = queue_get(&head, 4);
+				break;
+			case OP_SET_TIMING:
+				command->type = COMMAND_SET_TIMING;
+				command->length = queue_get(&head, 4);
+				command->spacing = queue_get(&head, 4);
+				break;
+			case OP_MARKER:
+				command->type = COMMAND_MARKER;
+				command->marker = queue_get(&head, 2);
+				break;
+		}
+	}
+	
+	// entries are published whole, so the rest of a run is already in the queue.
+	if (run_left > 0) {
+		command->type = COMMAND_TONE;
+		command->symbol = queue_get(&head, 1);
+		run_left--;
+	}
+	
+	STORE_RELEASE(queue_head, head);
+	return true;
+}
+
+void queue_get_stats(QueueStats *stats) {
+	stats->overflows = queue_stats.overflows;
+	stats->drops = queue_stats.drops;
+	stats->high_watermark = queue_stats.high_watermark;
+}
+
+#endif // QUEUE_MPSC
+
+bool enqueue(int x) {
+	uint8_t symbol = x;
+	return enqueue_sequence(&symbol, 1);
+}
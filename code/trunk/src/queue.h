@@ -1,12 +1,127 @@
-#ifndef QUEUE_H
-#define QUEUE_H
-
-#define QUEUE_N 2048
-
-extern int queue_size;
-extern int queue[QUEUE_N];
-
-void enqueue(int x);
-int check_and_dequeue(void);
-
-#endif // QUEUE_H
+#ifndef QUEUE_H
+#define QUEUE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * \brief Selects the multi-producer variant of the global command queue.
+ *
+ * When set to 0, the queue has a single producer and a single consumer, and packs commands
+ * into 4-bit slots. When set to 1, any number of producers (including interrupt handlers of
+ * different priorities) may append to the queue concurrently. Each command then takes a whole
+ * slot, which carries a sequence number used to hand it over to the consumer.
+ */
+#ifndef QUEUE_MPSC
+#define QUEUE_MPSC 0
+#endif
+
+#if QUEUE_MPSC
+/**
+ * \brief Capacity (in commands, or symbols of a sequence) of the global command queue. This must be a power of 2.
+ *
+ * Each slot takes 16 bytes of SRAM, so the queue takes #QUEUE_N * 16 bytes.
+ */
+#define QUEUE_N 512
+#else
+/**
+ * \brief Capacity (in 4-bit slots) of the global command queue. This must be a power of 2, and a multiple of 8.
+ *
+ * Slots are packed eight to a 32-bit word, so the queue takes #QUEUE_N / 2 bytes of SRAM.
+ * A sequence of symbols takes just over one slot per symbol, and other commands take up to 9 slots.
+ */
+#define QUEUE_N 16384
+#endif
+
+/**
+ * \brief Kinds of command carried by the global command queue.
+ */
+typedef enum CommandType {
+	COMMAND_TONE,           //!< Play the tone of #Command::symbol for #Command::length ms, followed by the inter-symbol spacing.
+	COMMAND_SILENCE,        //!< Output silence for #Command::length ms.
+	COMMAND_SET_TIMING,     //!< Play following tones for #Command::length ms, with #Command::spacing ms between them.
+	COMMAND_MARKER          //!< Report that playback reached this point, passing #Command::marker.
+} CommandType;
+
+/**
+ * \brief An entry of the global command queue.
+ *
+ * Fields which are not used by the command's #CommandType are ignored.
+ */
+typedef struct Command {
+	CommandType type;       //!< What the command does.
+	uint8_t symbol;         //!< Symbol played by #COMMAND_TONE (see dtmf_symbols.h).
+	uint8_t marker;         //!< Value reported by #COMMAND_MARKER.
+	uint16_t length;        //!< Length in ms. For #COMMAND_TONE, 0 selects the current symbol length.
+	uint16_t spacing;       //!< Inter-symbol spacing in ms set by #COMMAND_SET_TIMING.
+} Command;
+
+/**
+ * \brief Counters describing how full the global command queue has been.
+ *
+ * These are only written by the producer, and are never reset.
+ */
+typedef struct QueueStats {
+	unsigned overflows;         //!< Number of times the queue filled up and started rejecting values.
+	unsigned drops;             //!< Number of symbols or commands rejected because the queue was full.
+	unsigned high_watermark;    //!< Largest number of slots the queue has held at once.
+} QueueStats;
+
+/**
+ * \brief Appends a tone of the current symbol length to the global command queue.
+ *
+ * The queue has a single producer (the code which starts tones) and a single consumer
+ * (the DAC interrupt handler), which may run concurrently with each other. If #QUEUE_MPSC is set,
+ * there may be any number of producers. If the queue
+ * does not have room for the command, it is rejected, so that the producer can retry
+ * later instead of losing it.
+ *
+ * \param x The symbol whose tone is played. Only its lowest 4 bits are stored.
+ * \return Whether the command was appended.
+ */
+bool enqueue(int x);
+
+/**
+ * \brief Appends tones of the current symbol length for a sequence of symbols, all at once.
+ *
+ * The consumer sees either none or all of the sequence, since the tail of the queue is only
+ * published once, after every symbol has been stored. If there is no room for the whole
+ * sequence, nothing is appended, and every symbol counts as a drop.
+ *
+ * \param symbols The symbols to append. Only the lowest 4 bits of each are stored.
+ * \param n Number of symbols to append.
+ * \return Whether the sequence was appended.
+ */
+bool enqueue_sequence(const uint8_t *symbols, size_t n);
+
+/**
+ * \brief Appends a list of commands to the global command queue, all at once.
+ *
+ * Like enqueue_sequence(), either all or none of the commands are appended.
+ *
+ * \param commands The commands to append.
+ * \param n Number of commands to append.
+ * \return Whether the commands were appended.
+ */
+bool enqueue_commands(const Command *commands, size_t n);
+
+/**
+ * \brief Removes the command at the front of the global command queue.
+ *
+ * This never waits for producers. If #QUEUE_MPSC is set and the command at the front is still
+ * being written, the queue is reported as empty until that producer has finished.
+ *
+ * \param command Struct into which the command is copied.
+ * \return Whether there was a command in the queue.
+ */
+bool dequeue_command(Command *command);
+
+/**
+ * \brief Reads the counters of the global command queue.
+ *
+ * \param stats Struct into which the counters are copied.
+ */
+void queue_get_stats(QueueStats *stats);
+
+#endif // QUEUE_H
@@ -0,0 +1,27 @@
+#ifndef SINE_TABLES_H
+#define SINE_TABLES_H
+
+#include "settings.h"
+#include <stdint.h>
+
+/**
+ * \brief Peak value of the samples held in #sine_tables.
+ */
+#define SINE_AMPLITUDE 32767
+
+/**
+ * \brief Sine look-up tables used to generate tone samples, indexed by log base 2 of their size.
+ *
+ * A table of size 2^n holds the first quarter period of a sine wave sampled at 2^n points per period,
+ * plus the sample at the end of that quarter, so it has 2^(n-2) + 1 entries. Samples are signed and
+ * peak at #SINE_AMPLITUDE; the remaining three quarters of the period follow by symmetry.
+ *
+ * Tables are only present for sizes between #MIN_LUT_LOGSIZE and #MAX_LUT_LOGSIZE; the remaining
+ * entries are `NULL`.
+ *
+ * The tables are generated by `tools/gen_sine_tables.py` before every build and are placed in flash,
+ * so no sines are computed at run time.
+ */
+extern const int16_t * const sine_tables[MAX_LUT_LOGSIZE + 1];
+
+#endif // SINE_TABLES_H
@@ -0,0 +1,217 @@
+#include "timer_wheel.h"
+#include <platform.h>
+#include <timer.h>
+#include <stddef.h>
+
+/*
+ * The wheel has three levels. A timer which expires within 256 ticks is kept in the slot of
+ * level 0 for its tick, and later timers are kept in a slot of level 1 or 2 covering a range of
+ * ticks. Whenever level 0 wraps around, the timers of the next slot of level 1 are moved down
+ * into level 0, and likewise for level 2, so scheduling and cancelling never search.
+ */
+
+/**
+ * \brief Hardware timer match channel on which the wheel ticks.
+ */
+#define WHEEL_MATCH TIMER_MATCH_3
+
+/**
+ * \brief Number of bits of the tick which select a slot of level 0.
+ */
+#define LEVEL0_BITS 8
+
+/**
+ * \brief Number of bits of the tick which select a slot of levels 1 and 2.
+ */
+#define LEVELN_BITS 6
+
+#define LEVEL0_SIZE (1U << LEVEL0_BITS)
+#define LEVELN_SIZE (1U << LEVELN_BITS)
+#define LEVEL0_MASK (LEVEL0_SIZE - 1)
+#define LEVELN_MASK (LEVELN_SIZE - 1)
+
+/**
+ * \brief Slot of level \a LEVEL (1 or 2) which holds timers expiring at tick \a TICK.
+ */
+#define LEVELN_INDEX(TICK, LEVEL) \
+	(((TICK) >> (LEVEL0_BITS + ((LEVEL) - 1) * LEVELN_BITS)) & LEVELN_MASK)
+
+/**
+ * \brief Timers expiring within the next #LEVEL0_SIZE ticks, by tick.
+ */
+static SoftTimer *level0[LEVEL0_SIZE];
+
+/**
+ * \brief Timers expiring later, by ranges of ticks which get longer with each level.
+ */
+static SoftTimer *levelN[2][LEVELN_SIZE];
+
+/**
+ * \brief Tick which the next timer interrupt processes.
+ */
+static uint32_t wheel_ticks;
+
+/**
+ * \brief Number of pending timers. The hardware timer only ticks while this is not 0.
+ */
+static unsigned wheel_active;
+
+/**
+ * \brief Whether the timer interrupt is executing the callbacks of a tick.
+ */
+static bool wheel_in_tick;
+
+/**
+ * \brief Timer interrupt which executes the timers expiring at the current tick.
+ */
+static void wheel_tick_isr(void);
+
+/**
+ * \brief Puts a timer into the slot for its expiry tick.
+ *
+ * \param timer The timer, which must not be in any slot.
+ */
+static void wheel_insert(SoftTimer *timer);
+
+/**
+ * \brief Takes a timer out of its slot.
+ *
+ * \param timer The timer, which must be in a slot.
+ */
+static void wheel_unlink(SoftTimer *timer);
+
+/**
+ * \brief Moves every timer of a slot of level 1 or 2 into the slots of the lower levels.
+ *
+ * \param level The level of the slot.
+ * \param index The slot.
+ * \return \a index, so that the next level is only cascaded when this one wraps around.
+ */
+static unsigned wheel_cascade(int level, unsigned index);
+
+void timer_wheel_init(void) {
+	timer_configure();
+}
+
+static void wheel_insert(SoftTimer *timer) {
+	uint32_t ticks = timer->expires - wheel_ticks;
+	SoftTimer **slot;
+
+	if ((int32_t)ticks < 0) {
+		// already due, e.g. after a cascade which ran late.
+		slot = &level0[wheel_ticks & LEVEL0_MASK];
+	} else if (ticks < LEVEL0_SIZE) {
+		slot = &level0[timer->expires & LEVEL0_MASK];
+	} else if (ticks < 1UL << (LEVEL0_BITS + LEVELN_BITS)) {
+		slot = &levelN[0][LEVELN_INDEX(timer->expires, 1)];
+	} else {
+		if (ticks > TIMER_WHEEL_MAX_TICKS) {
+			timer->expires = wheel_ticks + TIMER_WHEEL_MAX_TICKS;
+		}
+		slot = &levelN[1][LEVELN_INDEX(timer->expires, 2)];
+	}
+
+	timer->next = *slot;
+	if (timer->next != NULL) {
+		timer->next->pprev = &timer->next;
+	}
+	timer->pprev = slot;
+	*slot = timer;
+}
+
+static void wheel_unlink(SoftTimer *timer) {
+	*timer->pprev = timer->next;
+	if (timer->next != NULL) {
+		timer->next->pprev = timer->pprev;
+	}
+	timer->next = NULL;
+	timer->pprev = NULL;
+}
+
+static unsigned wheel_cascade(int level, unsigned index) {
+	SoftTimer **slot = &levelN[level - 1][index];
+	SoftTimer *timer;
+
+	while ((timer = *slot) != NULL) {
+		wheel_unlink(timer);
+		wheel_insert(timer);
+	}
+	return index;
+}
+
+static void wheel_tick_isr(void) {
+	unsigned index = wheel_ticks & LEVEL0_MASK;
+	SoftTimer *timer;
+
+	if (index == 0 && wheel_cascade(1, LEVELN_INDEX(wheel_ticks, 1)) == 0) {
+		wheel_cascade(2, LEVELN_INDEX(wheel_ticks, 2));
+	}
+
+	// move on before executing callbacks, so that a timer scheduled by one lands in a later tick.
+	wheel_ticks++;
+	wheel_in_tick = true;
+
+	// take timers one at a time, as a callback may cancel another timer of the same slot.
+	while ((timer = level0[index]) != NULL) {
+		wheel_unlink(timer);
+		wheel_active--;
+		timer->callback();
+	}
+
+	wheel_in_tick = false;
+	if (wheel_active == 0) {
+		timer_match_disable(WHEEL_MATCH);
+	}
+}
+
+void timer_wheel_schedule(SoftTimer *timer, void (*callback)(void), unsigned delay) {
+	uint32_t primask = __get_PRIMASK();
+	uint32_t ticks = (delay + TIMER_WHEEL_TICK_MS - 1) / TIMER_WHEEL_TICK_MS;
+
+	if (ticks == 0) {
+		ticks = 1;
+	} else if (ticks > TIMER_WHEEL_MAX_TICKS) {
+		// also keeps the sum below from overflowing.
+		ticks = TIMER_WHEEL_MAX_TICKS;
+	}
+
+	__disable_irq();
+
+	if (timer->pprev != NULL) {
+		wheel_unlink(timer);
+		wheel_active--;
+	}
+
+	if (wheel_in_tick) {
+		// a tick has only just started, and the hardware timer keeps running until it ends.
+		timer->expires = wheel_ticks + ticks - 1;
+	} else if (wheel_active == 0) {
+		// the first tick is a whole tick from now, and processes #wheel_ticks.
+		timer_match_at(WHEEL_MATCH, wheel_tick_isr, timer_now(),
+		               PERIOD_MS_TO_CYCLES(TIMER_WHEEL_TICK_MS), PERIOD_MS_TO_CYCLES(TIMER_WHEEL_TICK_MS));
+		timer->expires = wheel_ticks + ticks - 1;
+	} else {
+		// part of the current tick may have elapsed, so wait for one more to never expire early.
+		timer->expires = wheel_ticks + ticks;
+	}
+	timer->callback = callback;
+	wheel_insert(timer);
+	wheel_active++;
+
+	__set_PRIMASK(primask);
+}
+
+void timer_wheel_cancel(SoftTimer *timer) {
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+	if (timer->pprev != NULL) {
+		wheel_unlink(timer);
+		wheel_active--;
+	}
+	__set_PRIMASK(primask);
+}
+
+bool timer_wheel_pending(const SoftTimer *timer) {
+	return timer->pprev != NULL;
+}
@@ -0,0 +1,71 @@
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * \brief Length (in ms) of one tick of the timer wheel, which is the resolution of every software timer.
+ */
+#ifndef TIMER_WHEEL_TICK_MS
+#define TIMER_WHEEL_TICK_MS 1
+#endif
+
+/**
+ * \brief Longest delay (in ticks) of a software timer. Longer delays are shortened to this.
+ *
+ * This is just over 17 minutes with 1 ms ticks.
+ */
+#define TIMER_WHEEL_MAX_TICKS ((1UL << 20) - 1)
+
+/**
+ * \brief A software timer, which executes a callback once its delay has elapsed.
+ *
+ * The struct is owned by the caller, and must stay in place while the timer is pending.
+ * A timer which has not been scheduled must be zero-initialised (e.g. by being static).
+ * Its fields are private to timer_wheel.c.
+ */
+typedef struct SoftTimer {
+	struct SoftTimer *next;     //!< Next timer in the same slot of the wheel.
+	struct SoftTimer **pprev;   //!< Link which points to this timer, or NULL if the timer is not pending.
+	uint32_t expires;           //!< Tick at which the timer expires.
+	void (*callback)(void);     //!< Function executed when the timer expires.
+} SoftTimer;
+
+/**
+ * \brief Sets up the timer wheel, which ticks on match channel 3 of the hardware timer.
+ *
+ * The hardware timer only ticks while a software timer is pending.
+ */
+void timer_wheel_init(void);
+
+/**
+ * \brief Schedules a software timer, replacing its previous schedule if it was already pending.
+ *
+ * This takes constant time. The callback is executed from the timer interrupt handler, no earlier
+ * than \a delay ms from now, and may itself schedule or cancel any timer.
+ *
+ * \param timer The timer to schedule.
+ * \param callback Function to execute when the timer expires.
+ * \param delay Delay (in ms) after which the callback is executed. This is rounded up to a whole number of ticks.
+ */
+void timer_wheel_schedule(SoftTimer *timer, void (*callback)(void), unsigned delay);
+
+/**
+ * \brief Cancels a software timer, so that its callback is not executed. This takes constant time.
+ *
+ * Cancelling a timer which is not pending has no effect.
+ *
+ * \param timer The timer to cancel.
+ */
+void timer_wheel_cancel(SoftTimer *timer);
+
+/**
+ * \brief Checks whether a software timer is waiting to expire.
+ *
+ * \param timer The timer to check.
+ * \return Whether the timer is pending.
+ */
+bool timer_wheel_pending(const SoftTimer *timer);
+
+#endif // TIMER_WHEEL_H
@@ -1,331 +1,1063 @@
-#include "tone.h"
-#include "dtmf_symbols.h"
-#include "queue.h"
-#include "lcd.h"
-#include "lpc_eeprom.h"
-#include "settings.h"
-#include <platform.h>
-#include <math.h>
-#include <dac.h>
-#include <timer.h>
-#include <gpio.h>
-#include <stdbool.h>
-#include <stddef.h>
-#include <limits.h>
-
-/** \brief Size of #sine_table as computed from global system settings
- */
-#define LUT_SIZE (1 << settings.lut_logsize)
-
-/** \brief Largest possible size of #sine_table.
- */
-#define MAX_LUT_SIZE (1 << MAX_LUT_LOGSIZE)
-
-/** \brief Determines the sampling rate of generated tone.
- *
- * The sampling frequency of a generated tone is its highest frequency component multiplied by
- * this constant. This constant was made as small as possible without the tone produced being
- * audibly distorted. The lower bound is 2 (as determined by the Nyquist criterion), but this is too
- * small to produce a clean tone.
- */
-#define SAMPLES_PER_PERIOD 4
-
-/**
- * Macro function for computing the value of lower frequency sine wave component of a tone.
- *
- * @param BASEFREQ The frequency of the other sine wave component of the tone being produced.
- *                 This partially determines the sampling frequency.
- * @param FREQ The frequency of the sine wave component being computed.
- * @param IDX The index of the sample being computed.
- */
-#define SIN(BASEFREQ, FREQ, IDX)                            \
-    ((sine_table[((FREQ) * (IDX) / (BASEFREQ)) & (LUT_SIZE-1)] +     \
-      sine_table[-(-(FREQ) * (IDX) / (BASEFREQ)) & (LUT_SIZE-1)]) >> \
-     1)
-
-/**
- * Macro function which computes a sample in a DTMF tone.
- * 
- * @param F1 The higher of the two frequency components of the tone.
- * @param F2 The lower of the two frequency components of the tone.
- * @param IDX The index of the sample being computed.
- */
-#define SIN_ADD(F1, F2, IDX) \
-    ((sine_table[(IDX) & (LUT_SIZE-1)] + SIN((F1), (F2), (IDX))) >> 1)
-
-/** 
- * \brief A flag which keeps track of whether a DAC interrupt is enabled or not
- * (i.e. whether a tone is being generated).
- */
-static int dac_interrupt_flag = 0;
-
-/**
- * \brief A global variable that keeps track of the current sample index in 
- * between invocations of the DAC interrupt handler.
- *
- * The DAC interrupt handler is invoked on a timer to update the DAC (by setting it to
- * output the next sample of a DTMF tone).
- *
- * Its state is torn down in between invocations, so this global stores the information
- * needed to continue producing the tone.
- */
-static int sample_index = 0;
-
-/**
- * \brief Attempts to enable the DAC interrupt which generates tone for a given symbol.
- *
- * Two tones cannot be generated at once, so this function first performs an
- * atomic test and set on a global flag that determines whether a DAC interrupt
- * is running. 
- * 
- * If the fetched value of the flag is true, an interrupt is already
- * running, and the function returns false.
- * Otherwise the function can enable the interrupt.
- *
- * The DAC interrupt is triggered on a timer, and so this function uses the
- * timer interface to enable the interrupt.
- *
- * @param col The column of the symbol whose tone is to be generated.
- * @param row The row of the symbol whose tone is to be generated.
- * @return Whether the function call succeeded in enabling the interrupt.
- */
-bool dac_interrupt_enable(int col, int row);
-
-/**
- * This function pops the next symbol off the global queue, and calls
- * dac_interrupt_enable_unsafe() to start generating its tone.
- *
- * Does nothing if the queue is empty.
- *
- * This is used by the DAC interrupt handler ONLY, and hence it does not use the
- * safe version of dac_interrupt_enable(), since the DAC interrupt cannot be pre-empted,
- * and we can assume that #dac_interrupt_flag is already set.
- * It is not safe to use in normal code.
- */
-static void pop_and_dac_interrupt_enable(void);
-
-/** Unsafe version of dac_interrupt_enable().
- *
- * Bypasses the atomic test-and-set operation done by dac_interrupt_enable().
- * This is fine when the function is called inside a DAC interrupt, as this cannot be
- * pre-empted, and we already know that #dac_interrupt_flag is set in this case.
- *
- * @param col The column of the symbol whose tone is to be generated.
- * @param row The row of the symbol whose tone is to be generated.
- */
-static void dac_interrupt_enable_unsafe(int col, int row);
-
-/**
- * Disable any DAC interrupt which is currently in progress.
- *
- * Sets the global DAC interrupt flag to false, 
- * and disables the timer interrupt.
- */
-static void dac_interrupt_disable(void);
-
-/*! \brief Approximation of pi used to generate the sine look-up table.
- */
-#define PI 3.1415927
-
-/*! \brief Sine look-up table used to generate tone samples.
- *
- * This is initialized at program start-up.
- */
-static int sine_table[MAX_LUT_SIZE];
-
-/**
- * \brief Generic function which contains the implementation of tone generation/output.
- * 
- * This function is specialized for each DTMF tone using TIMER_CALLBACK_ISR() macros.
- * 
- * \param base_freq the base frequency (the higher frequency)
- * \param freq the second frequency (the lower frequency)
- */
-static void timer_callback_isr(unsigned base_freq, unsigned freq);
-
-/**
- * \brief Initializes #sine_table with #NUM_STEPS samples from one period of the sine wave.
- */
-static void sinewave_init(void);
-
-void tone_init(void) {
-	dac_init();
-	sinewave_init();
-	
-	//Necessary for the timer to work
-	gpio_set_mode(P_SW, PullUp);
-}
-
-/**
- * \brief Macro used to construct the name for the specialised timer interrupt for each DTMF tone.
- * 
- * This is used mainly to create the dispatch table.
- * 
- * \param F1 the base frequency (the higher frequency)
- * \param F2 the second frequency (the lower frequency)
- */
-#define TIMER_CALLBACK_ISR_NAME(F1, F2) \
-	timer_callback_isr_##F1##_##F2
-
-/**
- * \brief Macro used to declare the specialised timer interrupt for each DTMF tone.
- *
- * \param F1 the base frequency (the higher frequency)
- * \param F2 the second frequency (the lower frequency)
- */
-#define TIMER_CALLBACK_ISR(F1, F2) \
-	static void TIMER_CALLBACK_ISR_NAME(F1, F2)(void)
-	
-TIMER_CALLBACK_ISR(1209, 697); // 1
-TIMER_CALLBACK_ISR(1336, 697); // 2
-TIMER_CALLBACK_ISR(1477, 697); // 3
-TIMER_CALLBACK_ISR(1633, 697); // A
-
-TIMER_CALLBACK_ISR(1209, 770); // 4
-TIMER_CALLBACK_ISR(1336, 770); // 5
-TIMER_CALLBACK_ISR(1477, 770); // 6
-TIMER_CALLBACK_ISR(1633, 770); // B
-	
-TIMER_CALLBACK_ISR(1209, 852); // 7
-TIMER_CALLBACK_ISR(1336, 852); // 8
-TIMER_CALLBACK_ISR(1477, 852); // 9
-TIMER_CALLBACK_ISR(1633, 852); // C
-	
-TIMER_CALLBACK_ISR(1209, 941); // *
-TIMER_CALLBACK_ISR(1336, 941); // 0
-TIMER_CALLBACK_ISR(1477, 941); // #
-TIMER_CALLBACK_ISR(1633, 941); // D
-
-
-/**
- * \brief Macro used to define the specialised timer interrupt for each DTMF tone.
- *
- * \param F1 the base frequency (the higher frequency)
- * \param F2 the second frequency (the lower frequency)
- */
-#define TIMER_CALLBACK_ISR_DEF(F1, F2) \
-	TIMER_CALLBACK_ISR(F1, F2) {         \
-		timer_callback_isr(F1, F2);        \
-	}
-	
-TIMER_CALLBACK_ISR_DEF(1209, 697); // 1
-TIMER_CALLBACK_ISR_DEF(1336, 697); // 2
-TIMER_CALLBACK_ISR_DEF(1477, 697); // 3
-TIMER_CALLBACK_ISR_DEF(1633, 697); // A
-
-TIMER_CALLBACK_ISR_DEF(1209, 770); // 4
-TIMER_CALLBACK_ISR_DEF(1336, 770); // 5
-TIMER_CALLBACK_ISR_DEF(1477, 770); // 6
-TIMER_CALLBACK_ISR_DEF(1633, 770); // B
-	
-TIMER_CALLBACK_ISR_DEF(1209, 852); // 7
-TIMER_CALLBACK_ISR_DEF(1336, 852); // 8
-TIMER_CALLBACK_ISR_DEF(1477, 852); // 9
-TIMER_CALLBACK_ISR_DEF(1633, 852); // C
-	
-TIMER_CALLBACK_ISR_DEF(1209, 941); // *
-TIMER_CALLBACK_ISR_DEF(1336, 941); // 0
-TIMER_CALLBACK_ISR_DEF(1477, 941); // #
-TIMER_CALLBACK_ISR_DEF(1633, 941); // D
-	
-/**
- * \brief A dispatch table of function pointers to specialised DTMF tone interrupts. 
- *
- * The array elements correspond to their symbols, and are organised in the same structure as the keypad.
- */
-static void (*dispatch_table[N_COLS][N_ROWS])(void) = {
-	{
-		TIMER_CALLBACK_ISR_NAME(1209, 697), // 1
-		TIMER_CALLBACK_ISR_NAME(1336, 697), // 2
-		TIMER_CALLBACK_ISR_NAME(1477, 697), // 3
-		TIMER_CALLBACK_ISR_NAME(1633, 697), // A
-	},
-	{
-		TIMER_CALLBACK_ISR_NAME(1209, 770), // 4
-		TIMER_CALLBACK_ISR_NAME(1336, 770), // 5
-		TIMER_CALLBACK_ISR_NAME(1477, 770), // 6
-		TIMER_CALLBACK_ISR_NAME(1633, 770), // B
-	},
-	{
-		TIMER_CALLBACK_ISR_NAME(1209, 852), // 7
-		TIMER_CALLBACK_ISR_NAME(1336, 852), // 8
-		TIMER_CALLBACK_ISR_NAME(1477, 852), // 9
-		TIMER_CALLBACK_ISR_NAME(1633, 852), // C
-	},
-	{
-		TIMER_CALLBACK_ISR_NAME(1209, 941), // *
-		TIMER_CALLBACK_ISR_NAME(1336, 941), // 0
-		TIMER_CALLBACK_ISR_NAME(1477, 941), // #
-		TIMER_CALLBACK_ISR_NAME(1633, 941), // D
-	}
-};
-
-/** \brief Array containing the higher frequency components of DTMF tones, ordered by column index.
- */
-static unsigned base_freqs[N_COLS] = {1209, 1336, 1477, 1633};
-
-__STATIC_INLINE void timer_callback_isr(unsigned base_freq, unsigned freq) {
-	int sample = SIN_ADD(base_freq, freq, sample_index);
-	sample_index += LUT_SIZE / SAMPLES_PER_PERIOD;
-	dac_set(sample);
-	
-	if (sample_index >= (base_freq * LUT_SIZE * settings.symbol_length) / 1000U) {
-		timer_set_callback_delay(pop_and_dac_interrupt_enable, PERIOD_MS_TO_CYCLES(settings.inter_symbol_spacing));
-	}
-}
-
-static void sinewave_init(void) {
-	int n;
-	for (n = 0; n < LUT_SIZE; n++) {
-		sine_table[n] = (int)((DAC_MASK) * (1 + sin(n * 2 * PI / LUT_SIZE)) / 2);
-	}
-}
-
-static void dac_interrupt_enable_unsafe(int col, int row)
-{
-    // reset sample index.
-    sample_index = 0;
-	
-    timer_set_callback(dispatch_table[row][col], FREQ_HZ_TO_CYCLES(base_freqs[col] * SAMPLES_PER_PERIOD));
-}
-
-static void pop_and_dac_interrupt_enable(void)
-{
-    int symbol;
-    if ((symbol = check_and_dequeue()) != INT_MIN)
-    {
-			dac_interrupt_enable_unsafe(COL(symbol), ROW(symbol));
-    } else {
-			dac_interrupt_disable();
-		}
-}
-
-static bool dac_interrupt_enable(int col, int row)
-{
-    // get old value of the flag
-    // NOTE: this has to be int not bool, so that the compiler doesn't get any funny ideas.
-    int flag = 1;
-	
-		flag = __sync_lock_test_and_set(&dac_interrupt_flag, flag);
-
-    if (!flag)
-    {
-			dac_init();
-      dac_interrupt_enable_unsafe(col, row);
-    }
-    return !flag; // return success
-}
-
-static void dac_interrupt_disable(void)
-{
-    dac_interrupt_flag = false;
-    timer_disable();
-}
-
-void tone_play_or_enqueue(int row, int col) {
-		int symbol = SYMBOL(row, col);
-		if (!dac_interrupt_enable(col, row)) {
-			enqueue(symbol);
-		}
-		lcd_put_char(symbol_chars[symbol]);
-}
+#include "tone.h"
+#include "dtmf_symbols.h"
+#include "queue.h"
+#include "lcd.h"
+#include "lpc_eeprom.h"
+#include "settings.h"
+#include "sine_tables.h"
+#include <platform.h>
+#include <dac.h>
+#include <timer.h>
+#include <gpio.h>
+#include <dma.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/** \brief Determines the sampling rate of generated tone.
+ *
+ * The sampling frequency of a generated tone is its highest frequency component multiplied by
+ * this constant. This constant was made as small as possible without the tone produced being
+ * audibly distorted. The lower bound is 2 (as determined by the Nyquist criterion), but this is too
+ * small to produce a clean tone.
+ */
+#define SAMPLES_PER_PERIOD 4
+
+/** \brief Number of bits in a phase accumulator.
+ *
+ * A phase accumulator wraps around once every period of the sine wave it tracks, so a full turn
+ * corresponds to 2^#PHASE_BITS. The top `settings.lut_logsize` bits of the accumulator index
+ * a full period sampled at 2^`settings.lut_logsize` points, which sine() folds into #sine_table.
+ */
+#define PHASE_BITS 32
+
+/**
+ * Macro function for computing the phase increment of a sine wave component.
+ *
+ * Adding this increment to a phase accumulator once per sample advances the accumulator
+ * by one full turn every 1/FREQ seconds.
+ *
+ * @param FREQ The frequency of the sine wave component.
+ * @param SAMPLE_RATE The rate (in Hz) at which samples are being generated.
+ */
+#define PHASE_INCREMENT(FREQ, SAMPLE_RATE) \
+	((uint32_t)(((uint64_t)(FREQ) << PHASE_BITS) / (SAMPLE_RATE)))
+
+/** \brief Bit of a phase accumulator which is set during the second half of a period.
+ */
+#define PHASE_HALF (1UL << (PHASE_BITS - 1))
+
+/** \brief Bit of a phase accumulator which is set during the second and fourth quarters of a period.
+ */
+#define PHASE_QUARTER (1UL << (PHASE_BITS - 2))
+
+/** \brief Number of bits of fractional phase used to interpolate between adjacent #sine_table entries.
+ *
+ * These are the bits of a phase accumulator just below those used as the table index. Since
+ * `settings.lut_logsize` is at most #MAX_LUT_LOGSIZE, at least #PHASE_BITS - #MAX_LUT_LOGSIZE bits
+ * are available, which must not be fewer than this.
+ */
+#define INTERP_BITS 16
+
+/**
+ * Macro function which converts a signed sample (with peak #SINE_AMPLITUDE) to a DAC code.
+ *
+ * Any `int16_t` is mapped onto the full range of the DAC, from 0 to #DAC_MASK.
+ *
+ * @param SAMPLE The sample to convert.
+ */
+#define SAMPLE_TO_DAC(SAMPLE) \
+	((uint16_t)(((SAMPLE) + SINE_AMPLITUDE + 1) >> (16 - DAC_BITS)))
+
+#if DAC_BITS > 16 || SINE_AMPLITUDE != INT16_MAX
+#error "SAMPLE_TO_DAC() assumes 16-bit signed samples and a DAC of at most 16 bits"
+#endif
+
+/** \brief DAC code output while no tone is being generated (the mid-point of the DAC range).
+ */
+#define DAC_SILENCE ((DAC_MASK + 1) >> 1)
+
+#if TONE_USE_DMA
+
+/** \brief GPDMA channel used to stream tone samples to the DAC.
+ */
+#define TONE_DMA_CHANNEL 0
+
+/**
+ * \brief Ping-pong buffers holding samples (as DAC register values) which are streamed to the DAC.
+ *
+ * While the GPDMA plays one buffer, the other is refilled from the DMA interrupt.
+ */
+static uint32_t dma_buffers[2][DMA_BUFFER_SIZE];
+
+/**
+ * \brief Linked list items which chain #dma_buffers into an endless loop.
+ */
+static DmaLli dma_lli[2];
+
+/**
+ * \brief The buffer in #dma_buffers which the GPDMA is currently playing (#PING or #PONG).
+ */
+static int playing_buffer;
+
+/**
+ * \brief The buffer in #dma_buffers which holds the last samples of the current tone, or -1 if these
+ * have not been rendered yet.
+ */
+static int final_buffer;
+
+/**
+ * \brief Number of samples in #final_buffer, whose transfer is shortened to end with them.
+ */
+static unsigned final_length;
+
+#if !TONE_SAMPLE_CACHE
+/**
+ * \brief Scratch block into which tone_render_block() writes samples before they are converted to
+ * DAC register values in #dma_buffers.
+ */
+static int16_t render_buffer[DMA_BUFFER_SIZE];
+#endif
+
+/**
+ * \brief Copies the next samples of the current tone into one of #dma_buffers, as DAC register values.
+ *
+ * \param samples Where the samples are written.
+ * \param n Number of samples to write.
+ */
+static void render_samples(uint32_t *samples, unsigned n);
+
+/**
+ * \brief Renders the next block of the current tone into one of #dma_buffers.
+ *
+ * The gap after the tone is rendered as silence. Once the gap is exhausted, #final_buffer is set,
+ * and its transfer is shortened to the samples rendered. If #TONE_SAMPLE_RATE is set, the gap is
+ * instead followed by the next symbol in the queue, so only the end of the whole sequence sets
+ * #final_buffer.
+ *
+ * \param buffer The buffer to fill (#PING or #PONG).
+ */
+static void fill_buffer(int buffer);
+
+/**
+ * \brief DMA interrupt, raised whenever the GPDMA finishes playing one of #dma_buffers.
+ *
+ * Refills the buffer which has just been played, or stops the stream and starts the next
+ * symbol if that buffer ended the gap after the current tone (or, if #TONE_SAMPLE_RATE is set,
+ * the sequence). The timer is never used while the GPDMA streams samples.
+ */
+static void dma_callback_isr(void);
+
+/**
+ * \brief Stops streaming samples to the DAC, and returns the DAC output to silence.
+ */
+static void dma_stream_stop(void);
+
+#endif // TONE_USE_DMA
+
+/** 
+ * \brief A flag which keeps track of whether a DAC interrupt is enabled or not
+ * (i.e. whether a tone is being generated).
+ */
+static int dac_interrupt_flag = 0;
+
+/**
+ * \brief Sampling rate (in Hz) of the tone currently being generated.
+ */
+static unsigned sample_rate;
+
+/**
+ * \brief Length (in ms) of tones which are played without an explicit length.
+ *
+ * This is copied from #settings by tone_init(), and changed by #COMMAND_SET_TIMING.
+ */
+static unsigned timing_symbol_length;
+
+/**
+ * \brief Length (in ms) of the silence after every tone.
+ *
+ * This is copied from #settings by tone_init(), and changed by #COMMAND_SET_TIMING.
+ */
+static unsigned timing_spacing;
+
+/**
+ * \brief Pointer to a function that is called by tone_dispatch_markers() for every #COMMAND_MARKER reached.
+ */
+static void (*marker_callback)(uint8_t) = NULL;
+
+/**
+ * \brief Mask which reduces an index modulo #TONE_MARKER_QUEUE_N.
+ */
+#define MARKER_MASK (TONE_MARKER_QUEUE_N - 1)
+
+/**
+ * \brief Ring buffer of the markers reached by playback, read by tone_dispatch_markers().
+ *
+ * Only the code which owns #dac_interrupt_flag executes the global queue, so there is one producer at a time.
+ */
+static uint8_t reached_markers[TONE_MARKER_QUEUE_N];
+
+/**
+ * \brief Free-running index of the next marker to be dispatched. Only written by the consumer.
+ */
+static volatile unsigned reached_markers_head = 0;
+
+/**
+ * \brief Free-running index of the next marker to be written. Only written by the producer.
+ */
+static volatile unsigned reached_markers_tail = 0;
+
+/**
+ * \brief Whether tones and gaps are timed by counting samples, rather than by timer deadlines.
+ *
+ * This is the case whenever the sample clock is not reprogrammed for every symbol, or is not
+ * driven by the timer at all.
+ */
+#define TONE_COUNT_SAMPLES (TONE_USE_DMA || TONE_SAMPLE_RATE)
+
+#if TONE_COUNT_SAMPLES
+/**
+ * \brief Number of samples of the current tone which have not yet been output.
+ *
+ * This is computed once whenever a tone is started, and counted down as samples are output, so that the
+ * DAC interrupt handler never needs to consult the global settings. When #TONE_USE_DMA is set,
+ * this counts samples which have not yet been rendered into the DMA buffers.
+ */
+static unsigned samples_left;
+#else
+/**
+ * \brief Length (in ms) of the current tone.
+ *
+ * The end of the tone is a timer deadline rather than a number of samples, so the timer interrupt
+ * handler never needs to count samples.
+ */
+static unsigned symbol_length;
+
+/**
+ * \brief Time (from timer_now()) at which the last scheduled tone or gap ends.
+ *
+ * Each tone or silence is scheduled from the end of the previous one rather than from when its
+ * interrupt ran, so the interrupt latency does not accumulate over a sequence.
+ */
+static uint32_t deadline;
+#endif
+
+#if TONE_COUNT_SAMPLES
+/**
+ * \brief Number of silent samples which remain to be output after the current tone, before the
+ * next symbol in the queue is started.
+ */
+static unsigned gap_left;
+
+/**
+ * \brief Executes the next commands in the global queue, without touching the sample clock.
+ *
+ * Used when the current tone and the gap following it have been output. A silence is played as
+ * a gap after an empty tone.
+ *
+ * \return Whether there was a tone or silence in the queue.
+ */
+static bool sequence_next(void);
+#endif
+
+#if TONE_USE_DMA && !TONE_SAMPLE_RATE
+/**
+ * \brief Sampling rate (in Hz) of a #COMMAND_SILENCE, which is streamed as silent samples.
+ *
+ * At 1 kHz each sample is exactly 1 ms, and the DAC counter period still fits in 16 bits.
+ */
+#define SILENCE_SAMPLE_RATE 1000
+#endif
+
+/**
+ * \brief Symbol whose tone is currently being generated.
+ */
+static int synth_symbol;
+
+/**
+ * \brief Phase accumulators of the tone currently being generated.
+ */
+static TonePhase synth_phase;
+
+/**
+ * \brief Amounts by which the phase accumulators of every symbol's tone are advanced on every sample,
+ * indexed by symbol.
+ *
+ * These only depend on the sampling rate of each symbol, so they are computed once by tone_init().
+ */
+static TonePhase phase_increments[N_ROWS * N_COLS];
+
+/**
+ * \brief Shift which converts a phase accumulator to an index into #sine_table.
+ *
+ * This is computed from `settings.lut_logsize` whenever a tone is started, so that the DAC interrupt
+ * handler does not need to consult the global settings.
+ */
+static unsigned lut_shift;
+
+/**
+ * \brief Mask which keeps the part of a #sine_table index that lies within a quarter period.
+ *
+ * Like #lut_shift, this is computed from `settings.lut_logsize` whenever a tone is started.
+ */
+static unsigned quarter_mask;
+
+/**
+ * \brief Phase difference between adjacent entries of the full period indexed by the phase accumulators.
+ */
+static uint32_t lut_step;
+
+/**
+ * \brief Shift which extracts the #INTERP_BITS fractional bits below the table index from a phase accumulator.
+ */
+static unsigned frac_shift;
+
+/**
+ * This function executes commands from the global queue until one which produces output,
+ * and starts generating its tone or silence.
+ *
+ * Disables the DAC interrupt if the queue runs out first.
+ *
+ * This is used by the DAC interrupt handler ONLY (or by code which has just set
+ * #dac_interrupt_flag itself), and hence it does not test the flag like
+ * playback_start() does, since the DAC interrupt cannot be pre-empted,
+ * and we can assume that #dac_interrupt_flag is already set.
+ * It is not safe to use in normal code.
+ */
+static void pop_and_dac_interrupt_enable(void);
+
+/**
+ * \brief Appends a marker reached by playback to #reached_markers, or drops it if the queue is full.
+ *
+ * \param marker The #Command::marker of the command reached.
+ */
+static void marker_push(uint8_t marker);
+
+/**
+ * \brief Executes commands from the global queue until one which produces output.
+ *
+ * Timing changes are applied and markers are queued along the way. A tone is prepared with
+ * symbol_start(), but the sample clock is left alone.
+ *
+ * \param silence Where the length (in ms) of a #COMMAND_SILENCE is written.
+ * \return The type of the command which produces output (#COMMAND_TONE or #COMMAND_SILENCE),
+ * or -1 if the queue ran out.
+ */
+static int command_next(unsigned *silence);
+
+/**
+ * \brief Starts the sample clock which outputs the tone prepared by symbol_start().
+ */
+static void stream_start(void);
+
+/**
+ * \brief Starts executing the global queue, unless a tone is already being generated.
+ */
+static void playback_start(void);
+
+/**
+ * Disable any DAC interrupt which is currently in progress.
+ *
+ * Sets the global DAC interrupt flag to false. Without #TONE_USE_DMA, this also disables the
+ * match channels used for playback, but leaves the timer and its other channels running.
+ */
+static void dac_interrupt_disable(void);
+
+/*! \brief Sine look-up table used to generate tone samples.
+ *
+ * This points into #sine_tables, and is selected from `settings.lut_logsize` whenever a tone is started.
+ * It only holds the first quarter of a period, see sine().
+ */
+static const int16_t *sine_table;
+
+/**
+ * \brief Looks up the #sine_table entry at or before a given phase.
+ *
+ * The top two bits of the phase select the quarter of the period. The second and fourth quarters
+ * read the table backwards, and the second half of the period negates the value read.
+ *
+ * \param phase The phase at which the table is read.
+ * \return The table entry, between -#SINE_AMPLITUDE and #SINE_AMPLITUDE.
+ */
+__STATIC_INLINE int16_t sine_entry(uint32_t phase);
+
+/**
+ * \brief Computes the value of a sine wave component from its phase accumulator.
+ *
+ * The value is linearly interpolated between the two #sine_table entries on either side of the
+ * phase, using the #INTERP_BITS phase bits below the table index as the weight. The result lies
+ * between those two entries, so it cannot leave the range of an `int16_t`.
+ *
+ * \param phase The phase accumulator of the sine wave component.
+ * \return The value of the sine wave component, between -#SINE_AMPLITUDE and #SINE_AMPLITUDE.
+ */
+__STATIC_INLINE int16_t sine(uint32_t phase);
+
+/**
+ * \brief Computes the next sample of the tone currently being generated, and advances the phase accumulators.
+ *
+ * The two components are averaged rather than summed, so the mixed sample stays within
+ * -#SINE_AMPLITUDE and #SINE_AMPLITUDE.
+ *
+ * \return The DAC code of the sample, between 0 and #DAC_MASK.
+ */
+__STATIC_INLINE uint16_t synth_sample(void);
+
+/**
+ * \brief Selects #sine_table and computes the look-up parameters derived from `settings.lut_logsize`.
+ */
+static void lut_select(void);
+
+/**
+ * \brief Prepares the phase accumulators and the look-up parameters used by synth_sample() and
+ * tone_render_block() to generate the tone of a given symbol.
+ *
+ * @param col The column of the symbol whose tone is to be generated.
+ * @param row The row of the symbol whose tone is to be generated.
+ */
+static void synth_start(int col, int row);
+
+/**
+ * \brief Prepares the state used to output the tone of a given symbol.
+ *
+ * This sets up the synthesiser (or selects the symbol's block in the sample cache) and the
+ * number of samples to output.
+ *
+ * @param col The column of the symbol whose tone is to be generated.
+ * @param row The row of the symbol whose tone is to be generated.
+ * @param length The length (in ms) of the tone, which must not be 0.
+ */
+static void symbol_start(int col, int row, unsigned length);
+
+/**
+ * \brief Returns the next sample of the tone currently being played.
+ *
+ * Samples are read from the sample cache if #TONE_SAMPLE_CACHE is set, and synthesised otherwise.
+ *
+ * \return The DAC code of the sample, between 0 and #DAC_MASK.
+ */
+__STATIC_INLINE uint16_t next_sample(void);
+
+#if TONE_SAMPLE_CACHE
+
+/**
+ * \brief Pre-rendered samples (as DAC codes) of every symbol, indexed by symbol.
+ *
+ * Only the first `cache_lengths[symbol]` samples of each block are used.
+ */
+static uint16_t cache[N_ROWS * N_COLS][TONE_CACHE_LENGTH];
+
+/**
+ * \brief Number of samples in each block of #cache.
+ */
+static unsigned cache_lengths[N_ROWS * N_COLS];
+
+/**
+ * \brief Block of #cache holding the tone currently being played.
+ */
+static const uint16_t *cached_samples;
+
+/**
+ * \brief Number of samples in #cached_samples.
+ */
+static unsigned cached_length;
+
+/**
+ * \brief Index of the next sample to be played from #cached_samples.
+ */
+static unsigned cache_index;
+
+/**
+ * Macro function giving the distance between a phase and the nearest whole number of turns.
+ *
+ * @param PHASE The phase (modulo 2^#PHASE_BITS).
+ */
+#define PHASE_ERROR(PHASE) \
+	((PHASE) < PHASE_HALF ? (PHASE) : (uint32_t)0 - (PHASE))
+
+/**
+ * \brief Rebuilds #cache from the current #settings.
+ *
+ * For each symbol, the block length is the one (up to #TONE_CACHE_LENGTH) after which both
+ * phase accumulators come closest to a whole number of turns, so that playing the block in a
+ * loop keeps the tone's phase as continuous as possible.
+ */
+static void cache_build(void);
+
+#endif // TONE_SAMPLE_CACHE
+
+#if !TONE_USE_DMA
+/**
+ * \brief Timer match channel which clocks out samples.
+ */
+#define MATCH_SAMPLE TIMER_MATCH_0
+
+/**
+ * \brief Timer match channel whose deadline is the end of the current tone.
+ */
+#define MATCH_SYMBOL_END TIMER_MATCH_1
+
+/**
+ * \brief Timer match channel whose deadline is the end of the current gap or silence.
+ */
+#define MATCH_GAP TIMER_MATCH_2
+
+/**
+ * \brief Timer interrupt which outputs the next sample of the tone currently being generated.
+ * 
+ * The tone is synthesised directly from the phase accumulators in #synth_phase (see #TonePhase),
+ * which are advanced by the increments of #synth_symbol on every invocation.
+ */
+static void timer_callback_isr(void);
+
+#if !TONE_SAMPLE_RATE
+/**
+ * \brief Timer interrupt at the #MATCH_SYMBOL_END deadline, which stops the sample clock and silences the DAC.
+ */
+static void symbol_end_isr(void);
+#endif
+#endif
+
+/** \brief Array containing the higher frequency components of DTMF tones, ordered by column index.
+ */
+static unsigned base_freqs[N_COLS] = {1209, 1336, 1477, 1633};
+
+/** \brief Array containing the lower frequency components of DTMF tones, ordered by row index.
+ */
+static unsigned freqs[N_ROWS] = {697, 770, 852, 941};
+
+/**
+ * Macro function giving the sampling rate (in Hz) of the tones in a given column.
+ *
+ * @param COL The column of the symbol.
+ */
+#if TONE_SAMPLE_RATE
+#define SYMBOL_SAMPLE_RATE(COL) TONE_SAMPLE_RATE
+#else
+#define SYMBOL_SAMPLE_RATE(COL) (base_freqs[COL] * SAMPLES_PER_PERIOD)
+#endif
+
+void tone_init(void) {
+	int symbol;
+	
+	dac_init();
+	
+	for (symbol = 0; symbol < N_ROWS * N_COLS; symbol++) {
+		phase_increments[symbol].base_phase = PHASE_INCREMENT(base_freqs[COL(symbol)], SYMBOL_SAMPLE_RATE(COL(symbol)));
+		phase_increments[symbol].phase = PHASE_INCREMENT(freqs[ROW(symbol)], SYMBOL_SAMPLE_RATE(COL(symbol)));
+	}
+	lut_select();
+	
+	timing_symbol_length = settings.symbol_length;
+	timing_spacing = settings.inter_symbol_spacing;
+#if TONE_SAMPLE_RATE
+	// a sequence may start with a silence, before any tone has set the sampling rate.
+	sample_rate = TONE_SAMPLE_RATE;
+#endif
+	
+#if TONE_SAMPLE_CACHE
+	cache_build();
+#endif
+	
+#if TONE_USE_DMA
+	dma_init();
+	dma_set_callback(dma_callback_isr);
+#endif
+	
+#if !TONE_USE_DMA
+	timer_configure();
+#endif
+	
+	//Necessary for the timer to work
+	gpio_set_mode(P_SW, PullUp);
+}
+
+__STATIC_INLINE int16_t sine_entry(uint32_t phase) {
+	unsigned index = (phase >> lut_shift) & quarter_mask;
+	
+	if (phase & PHASE_QUARTER) {
+		index = quarter_mask + 1 - index;
+	}
+	return (phase & PHASE_HALF) ? -sine_table[index] : sine_table[index];
+}
+
+__STATIC_INLINE int16_t sine(uint32_t phase) {
+	int a = sine_entry(phase);
+	int b = sine_entry(phase + lut_step);
+	int frac = (phase >> frac_shift) & ((1 << INTERP_BITS) - 1);
+	
+	return a + (((b - a) * frac) >> INTERP_BITS);
+}
+
+__STATIC_INLINE uint16_t synth_sample(void) {
+	int16_t sample = (sine(synth_phase.base_phase) + sine(synth_phase.phase)) >> 1;
+	synth_phase.base_phase += phase_increments[synth_symbol].base_phase;
+	synth_phase.phase += phase_increments[synth_symbol].phase;
+	return SAMPLE_TO_DAC(sample);
+}
+
+void tone_render_block(int symbol, TonePhase *phase_state, int16_t *dst, unsigned n) {
+	uint32_t base_phase = phase_state->base_phase;
+	uint32_t phase = phase_state->phase;
+	uint32_t base_phase_increment = phase_increments[symbol].base_phase;
+	uint32_t phase_increment = phase_increments[symbol].phase;
+	
+	for (; n > 0; n--) {
+		*dst++ = (sine(base_phase) + sine(phase)) >> 1;
+		base_phase += base_phase_increment;
+		phase += phase_increment;
+	}
+	
+	phase_state->base_phase = base_phase;
+	phase_state->phase = phase;
+}
+
+static void lut_select(void) {
+	sine_table = sine_tables[settings.lut_logsize];
+	lut_shift = PHASE_BITS - settings.lut_logsize;
+	quarter_mask = (1U << (settings.lut_logsize - 2)) - 1;
+	lut_step = 1UL << lut_shift;
+	frac_shift = lut_shift - INTERP_BITS;
+}
+
+static void synth_start(int col, int row) {
+	synth_symbol = SYMBOL(row, col);
+	synth_phase.base_phase = 0;
+	synth_phase.phase = 0;
+	sample_rate = SYMBOL_SAMPLE_RATE(col);
+	lut_select();
+}
+
+#if TONE_SAMPLE_CACHE
+
+__STATIC_INLINE uint16_t next_sample(void) {
+	uint16_t sample = cached_samples[cache_index];
+	if (++cache_index == cached_length) {
+		cache_index = 0;
+	}
+	return sample;
+}
+
+static void cache_build(void) {
+	int symbol;
+	unsigned n, length;
+	uint32_t error, base_error, best_error;
+	TonePhase block_phase;
+	int16_t *block;
+	
+	for (symbol = 0; symbol < N_ROWS * N_COLS; symbol++) {
+		length = TONE_CACHE_LENGTH;
+		best_error = UINT32_MAX;
+		for (n = 1; n <= TONE_CACHE_LENGTH; n++) {
+			base_error = PHASE_ERROR(n * phase_increments[symbol].base_phase);
+			error = PHASE_ERROR(n * phase_increments[symbol].phase);
+			if (base_error > error) {
+				error = base_error;
+			}
+			if (error < best_error) {
+				best_error = error;
+				length = n;
+			}
+		}
+		
+		cache_lengths[symbol] = length;
+		
+		// render signed samples in place, then convert them to DAC codes.
+		block = (int16_t *)cache[symbol];
+		block_phase.base_phase = 0;
+		block_phase.phase = 0;
+		tone_render_block(symbol, &block_phase, block, length);
+		for (n = 0; n < length; n++) {
+			cache[symbol][n] = SAMPLE_TO_DAC(block[n]);
+		}
+	}
+}
+
+#else
+
+__STATIC_INLINE uint16_t next_sample(void) {
+	return synth_sample();
+}
+
+#endif // TONE_SAMPLE_CACHE
+
+#if TONE_USE_DMA
+
+#if TONE_SAMPLE_CACHE
+
+static void render_samples(uint32_t *samples, unsigned n) {
+	for (; n > 0; n--) {
+		*samples++ = DAC_VALUE(next_sample());
+	}
+}
+
+#else
+
+static void render_samples(uint32_t *samples, unsigned n) {
+	unsigned i;
+	
+	tone_render_block(synth_symbol, &synth_phase, render_buffer, n);
+	for (i = 0; i < n; i++) {
+		samples[i] = DAC_VALUE(SAMPLE_TO_DAC(render_buffer[i]));
+	}
+}
+
+#endif // TONE_SAMPLE_CACHE
+
+static void fill_buffer(int buffer) {
+	uint32_t *samples = dma_buffers[buffer];
+	unsigned i = 0, n;
+	
+	// once the final buffer has been rendered, nothing after it will be played.
+	while (final_buffer < 0 && i < DMA_BUFFER_SIZE) {
+		if (samples_left > 0) {
+			n = samples_left < DMA_BUFFER_SIZE - i ? samples_left : DMA_BUFFER_SIZE - i;
+			samples_left -= n;
+			render_samples(samples + i, n);
+			i += n;
+		} else if (gap_left > 0) {
+			n = gap_left < DMA_BUFFER_SIZE - i ? gap_left : DMA_BUFFER_SIZE - i;
+			gap_left -= n;
+			for (; n > 0; n--) {
+				samples[i++] = DAC_VALUE(DAC_SILENCE);
+			}
+#if TONE_SAMPLE_RATE
+		} else if (!sequence_next()) {
+			break;
+		}
+#else
+		} else {
+			// the next symbol restarts the stream at its own rate.
+			break;
+		}
+#endif
+	}
+	
+	if (i < DMA_BUFFER_SIZE && final_buffer < 0) {
+		// the channel stops by itself after the final buffer, rather than replay the other one until
+		// dma_callback_isr() disables it.
+		if (i == 0) {
+			// the other buffer, which the channel has already loaded, ended exactly at its end. Its link
+			// cannot be changed while the channel runs, so this one becomes a single silent sample.
+			// If that buffer has not been started yet, stream_start() stops the channel after all of it.
+			final_buffer = buffer ^ 1;
+			final_length = DMA_BUFFER_SIZE;
+			samples[0] = DAC_VALUE(DAC_SILENCE);
+			dma_link_transfersize(&dma_lli[buffer], 1);
+			dma_lli[buffer].Next = NULL;
+		} else {
+			// shorten the transfer, so that the stream stops right at the end of the gap.
+			final_buffer = buffer;
+			final_length = i;
+			dma_link_transfersize(&dma_lli[buffer], i);
+			dma_lli[buffer].Next = NULL;
+		}
+	}
+}
+
+static void dma_callback_isr(void) {
+	int finished = playing_buffer;
+	
+	playing_buffer ^= 1;
+	
+	if (finished != final_buffer) {
+		fill_buffer(finished);
+		return;
+	}
+	
+	dma_stream_stop();
+	
+	// the gap after the last symbol has already been played. If #TONE_SAMPLE_RATE is set, the queue
+	// was empty when it was rendered, otherwise the next symbol starts a new stream at its own rate.
+	pop_and_dac_interrupt_enable();
+}
+
+static void dma_stream_stop(void) {
+	dac_dma_disable();
+	dma_disable(TONE_DMA_CHANNEL);
+	dac_set(DAC_SILENCE);
+}
+
+#else
+
+#if TONE_SAMPLE_RATE
+
+static void timer_callback_isr(void) {
+	if (samples_left > 0) {
+		samples_left--;
+		dac_set(next_sample());
+	} else if (gap_left > 0) {
+		gap_left--;
+		dac_set(DAC_SILENCE);
+	} else if (!sequence_next()) {
+		dac_interrupt_disable();
+	}
+}
+
+#else
+
+static void timer_callback_isr(void) {
+	dac_set(next_sample());
+}
+
+static void symbol_end_isr(void) {
+	timer_match_disable(MATCH_SAMPLE);
+	dac_set(DAC_SILENCE);
+}
+
+#endif // TONE_SAMPLE_RATE
+
+#endif // TONE_USE_DMA
+
+static void symbol_start(int col, int row, unsigned length)
+{
+    // reset phase accumulators.
+    synth_start(col, row);
+	
+#if TONE_SAMPLE_CACHE
+    cached_samples = cache[SYMBOL(row, col)];
+    cached_length = cache_lengths[SYMBOL(row, col)];
+    cache_index = 0;
+#endif
+	
+#if TONE_COUNT_SAMPLES
+    // length is at least 1 ms, and every sampling rate is above 1 kHz, so this is never 0.
+    samples_left = (sample_rate * length) / 1000U;
+    gap_left = (sample_rate * timing_spacing) / 1000U;
+#else
+    symbol_length = length;
+#endif
+}
+
+static void marker_push(uint8_t marker)
+{
+    unsigned tail = reached_markers_tail;
+	
+    if (tail - reached_markers_head == TONE_MARKER_QUEUE_N)
+    {
+        return;
+    }
+    reached_markers[tail & MARKER_MASK] = marker;
+	
+    // the marker must be written before the consumer can see it.
+    __DMB();
+    reached_markers_tail = tail + 1;
+}
+
+static int command_next(unsigned *silence)
+{
+    Command command;
+	
+    while (dequeue_command(&command))
+    {
+        switch (command.type)
+        {
+            case COMMAND_TONE:
+                symbol_start(COL(command.symbol), ROW(command.symbol),
+                             command.length > 0 ? command.length : timing_symbol_length);
+                return COMMAND_TONE;
+            case COMMAND_SILENCE:
+                if (command.length > 0)
+                {
+                    *silence = command.length;
+                    return COMMAND_SILENCE;
+                }
+                break;
+            case COMMAND_SET_TIMING:
+                if (command.length > 0)
+                {
+                    timing_symbol_length = command.length;
+                }
+                timing_spacing = command.spacing;
+                break;
+            case COMMAND_MARKER:
+                marker_push(command.marker);
+                break;
+        }
+    }
+    return -1;
+}
+
+#if TONE_COUNT_SAMPLES
+static bool sequence_next(void)
+{
+    unsigned silence;
+	
+    switch (command_next(&silence))
+    {
+        case COMMAND_TONE:
+            return true;
+        case COMMAND_SILENCE:
+#if !TONE_SAMPLE_RATE
+            // the stream is restarted for the silence, at a rate which is independent of the last tone.
+            sample_rate = SILENCE_SAMPLE_RATE;
+#endif
+            samples_left = 0;
+            gap_left = (sample_rate * silence) / 1000U;
+            return true;
+        default:
+            return false;
+    }
+}
+#endif
+
+static void stream_start(void)
+{
+#if TONE_USE_DMA
+    dma_setup(TONE_DMA_CHANNEL, (uint32_t)dma_buffers[PING], (uint32_t)&LPC_DAC->CR,
+              0, DMA_PERIPH_DAC, DMA_BUFFER_SIZE, DMA_BURST_1, DMA_WIDTH_WORD, DMA_M2P,
+              (uint32_t)&dma_lli[PONG]);
+    dma_link(TONE_DMA_CHANNEL, &dma_lli[PING], (uint32_t)dma_buffers[PING], (uint32_t)&LPC_DAC->CR, &dma_lli[PONG]);
+    dma_link(TONE_DMA_CHANNEL, &dma_lli[PONG], (uint32_t)dma_buffers[PONG], (uint32_t)&LPC_DAC->CR, &dma_lli[PING]);
+	
+    // the buffers are filled after linking, so that a final buffer can shorten its transfer.
+    final_buffer = -1;
+    fill_buffer(PING);
+    fill_buffer(PONG);
+    playing_buffer = PING;
+    if (final_buffer == PING)
+    {
+        // the first buffer was set up by dma_setup() rather than loaded from its linked list item.
+        dma_transfersize(TONE_DMA_CHANNEL, final_length);
+        dma_next_lli(TONE_DMA_CHANNEL, NULL);
+    }
+    dma_enable(TONE_DMA_CHANNEL);
+	
+    dac_dma_enable(PeripheralClock / sample_rate);
+#elif TONE_SAMPLE_RATE
+    timer_rearm(timer_callback_isr, FREQ_HZ_TO_CYCLES(sample_rate));
+#else
+    // the end of the tone and of the gap after it are deadlines from the same base, so neither depends on
+    // how many samples were output.
+    timer_match_at(MATCH_SAMPLE, timer_callback_isr, deadline,
+                   FREQ_HZ_TO_CYCLES(sample_rate), FREQ_HZ_TO_CYCLES(sample_rate));
+    // lengths go up to 65535 ms, which only fits in 32 bits as counter ticks.
+    deadline = timer_match_at_ticks(MATCH_SYMBOL_END, symbol_end_isr, deadline, PERIOD_MS_TO_TICKS(symbol_length), 0);
+    deadline = timer_match_at_ticks(MATCH_GAP, pop_and_dac_interrupt_enable, deadline, PERIOD_MS_TO_TICKS(timing_spacing), 0);
+#endif
+}
+
+static void pop_and_dac_interrupt_enable(void)
+{
+#if TONE_COUNT_SAMPLES
+    if (sequence_next())
+    {
+        stream_start();
+    } else {
+        dac_interrupt_disable();
+    }
+#else
+    unsigned silence;
+	
+    switch (command_next(&silence))
+    {
+        case COMMAND_TONE:
+            stream_start();
+            break;
+        case COMMAND_SILENCE:
+            deadline = timer_match_at_ticks(MATCH_GAP, pop_and_dac_interrupt_enable, deadline, PERIOD_MS_TO_TICKS(silence), 0);
+            break;
+        default:
+            dac_interrupt_disable();
+            break;
+    }
+#endif
+}
+
+static void playback_start(void)
+{
+    // owning the flag means no interrupt can be consuming the queue, so popping it directly is fine here.
+    if (!__sync_lock_test_and_set(&dac_interrupt_flag, 1))
+    {
+        dac_init();
+#if !TONE_COUNT_SAMPLES
+        deadline = timer_now();
+#endif
+        pop_and_dac_interrupt_enable();
+    }
+}
+
+static void dac_interrupt_disable(void)
+{
+    dac_interrupt_flag = false;
+#if !TONE_USE_DMA
+    // only stop the channels used for playback, as other channels may be in use (see timer_wheel.h).
+    timer_match_disable(MATCH_SAMPLE);
+    timer_match_disable(MATCH_SYMBOL_END);
+    timer_match_disable(MATCH_GAP);
+#endif
+}
+
+void tone_play_or_enqueue(int row, int col) {
+		tone_try_play_or_enqueue(row, col);
+}
+
+bool tone_try_play_or_enqueue(int row, int col) {
+		int symbol = SYMBOL(row, col);
+		
+		// the symbol is queued before the flag is tested, so that if playback is just finishing,
+		// either it still sees the symbol, or this call finds the flag clear and restarts it.
+		if (!enqueue(symbol)) {
+			return false;
+		}
+		lcd_put_char(symbol_chars[symbol]);
+		
+		playback_start();
+		return true;
+}
+
+bool tone_play_sequence(const uint8_t *symbols, size_t n) {
+		size_t i;
+		
+		if (!enqueue_sequence(symbols, n)) {
+			return false;
+		}
+		for (i = 0; i < n; i++) {
+			lcd_put_char(symbol_chars[symbols[i] & 0xF]);
+		}
+		
+		playback_start();
+		return true;
+}
+
+bool tone_play_commands(const Command *commands, size_t n) {
+		size_t i;
+		
+		if (!enqueue_commands(commands, n)) {
+			return false;
+		}
+		for (i = 0; i < n; i++) {
+			if (commands[i].type == COMMAND_TONE) {
+				lcd_put_char(symbol_chars[commands[i].symbol & 0xF]);
+			}
+		}
+		
+		playback_start();
+		return true;
+}
+
+void tone_set_marker_callback(void (*callback)(uint8_t)) {
+		marker_callback = callback;
+}
+
+bool tone_marker_pending(void) {
+		return reached_markers_head != reached_markers_tail;
+}
+
+void tone_dispatch_markers(void) {
+		unsigned head;
+		uint8_t marker;
+		
+		while ((head = reached_markers_head) != reached_markers_tail) {
+			// the marker must not be read before the tail which published it.
+			__DMB();
+			marker = reached_markers[head & MARKER_MASK];
+			__DMB();
+			reached_markers_head = head + 1;
+			
+			// the callback may change itself, so it is read again for every marker.
+			if (marker_callback != NULL) {
+				marker_callback(marker);
+			}
+		}
+}
@@ -1,20 +1,169 @@
-#ifndef TONE_H
-#define TONE_H
-
-/**
- * \brief Initialises the DAC and creates the Sin Wave LUT.
- */
-void tone_init(void);
-
-/**
- * \brief Attempts to start an interrupt to generate a tone, and displays symbol on the LCD.
- * 
- * If a tone is already being generated, the symbol corresponding to the tone is 
- * enqueued to a global queue. The symbol's corresponding character is displayed on the LCD.
- *
- * \param col The column of the symbol whose tone is to be generated.
- * \param row The row of the symbol whose tone is to be generated.
- */
-void tone_play_or_enqueue(int row, int col);
-
-#endif // TONE_H
+#ifndef TONE_H
+#define TONE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "queue.h"
+
+/**
+ * \brief Selects how tone samples are delivered to the DAC.
+ *
+ * When set to 1, samples are rendered in blocks of #DMA_BUFFER_SIZE into a pair of ping-pong
+ * buffers, which the GPDMA streams to the DAC at the pace of the DAC's own counter. The gaps
+ * between tones and silences are streamed as silent samples, so the timer is not used at all.
+ * When set to 0, a timer interrupt writes every sample to the DAC.
+ */
+#ifndef TONE_USE_DMA
+#define TONE_USE_DMA 1
+#endif
+
+/**
+ * \brief Fixed sampling rate (in Hz) used for every symbol, or 0 to use a per-symbol rate.
+ *
+ * When 0, each symbol is sampled at its higher frequency component multiplied by
+ * `SAMPLES_PER_PERIOD`, so the sample clock is reprogrammed for every symbol and every gap.
+ * Otherwise all symbols (and the silence between them) are generated at this rate, and the
+ * sample clock runs uninterrupted from the first symbol of a sequence to the last.
+ */
+#ifndef TONE_SAMPLE_RATE
+#define TONE_SAMPLE_RATE 0
+#endif
+
+/**
+ * \brief Enables the per-symbol sample cache.
+ *
+ * When set to 1, tone_init() pre-renders a block of samples for every symbol, whose length is
+ * chosen so that the block loops back onto itself as smoothly as possible. Playing a tone then
+ * only copies samples out of the cache, instead of synthesising them. The cache takes
+ * #N_ROWS * #N_COLS * #TONE_CACHE_LENGTH 16-bit samples of SRAM.
+ */
+#ifndef TONE_SAMPLE_CACHE
+#define TONE_SAMPLE_CACHE 0
+#endif
+
+/**
+ * \brief Maximum length (in samples) of a block in the per-symbol sample cache.
+ */
+#define TONE_CACHE_LENGTH 256
+
+/**
+ * \brief Phase accumulators of the two sine wave components of a tone.
+ *
+ * A full turn of either accumulator is one period of its sine wave. Passing the same struct to
+ * consecutive calls of tone_render_block() continues the tone without a discontinuity.
+ */
+typedef struct TonePhase {
+	uint32_t base_phase;    //!< Phase of the higher frequency component.
+	uint32_t phase;         //!< Phase of the lower frequency component.
+} TonePhase;
+
+/**
+ * \brief Initialises the DAC and the peripherals used to stream tone samples to it.
+ *
+ * If #TONE_SAMPLE_CACHE is set, the sample cache is also rebuilt from the current #settings,
+ * so this must be called again whenever the settings change.
+ */
+void tone_init(void);
+
+/**
+ * \brief Renders a block of samples of a symbol's tone.
+ *
+ * Samples are signed, with a peak of #SINE_AMPLITUDE, and are generated at the symbol's sampling rate
+ * using the look-up table selected by `settings.lut_logsize` when tone_init() was last called or a
+ * tone was last started.
+ *
+ * \param symbol The symbol whose tone is rendered.
+ * \param phase_state The phase accumulators at the first sample, which are advanced past the last one.
+ * \param dst Buffer which receives the samples.
+ * \param n Number of samples to render.
+ */
+void tone_render_block(int symbol, TonePhase *phase_state, int16_t *dst, unsigned n);
+
+/**
+ * \brief Attempts to start an interrupt to generate a tone, and displays symbol on the LCD.
+ * 
+ * If a tone is already being generated, the symbol corresponding to the tone is 
+ * enqueued to a global queue. The symbol's corresponding character is displayed on the LCD.
+ *
+ * \param col The column of the symbol whose tone is to be generated.
+ * \param row The row of the symbol whose tone is to be generated.
+ */
+void tone_play_or_enqueue(int row, int col);
+
+/**
+ * \brief Version of tone_play_or_enqueue() which reports whether the symbol was accepted.
+ *
+ * If the global queue is full, the symbol is neither played nor displayed, and the caller
+ * should retry once some of the queued symbols have been played.
+ *
+ * \param col The column of the symbol whose tone is to be generated.
+ * \param row The row of the symbol whose tone is to be generated.
+ * \return Whether the symbol was played or enqueued.
+ */
+bool tone_try_play_or_enqueue(int row, int col);
+
+/**
+ * \brief Enqueues a whole sequence of symbols, starts playing it if no tone is being generated,
+ * and displays the symbols on the LCD.
+ *
+ * The sequence is published to the global queue in one go, so its symbols are played
+ * back to back, after any symbols which were already queued.
+ *
+ * \param symbols The symbols to play (see dtmf_symbols.h).
+ * \param n Number of symbols to play.
+ * \return Whether the sequence was accepted. If the global queue does not have room for the
+ * whole sequence, none of it is played or displayed.
+ */
+bool tone_play_sequence(const uint8_t *symbols, size_t n);
+
+/**
+ * \brief Enqueues a list of commands, starts executing the queue if no tone is being generated,
+ * and displays the symbols of any tones on the LCD.
+ *
+ * Commands are executed from the DAC interrupt handler as playback reaches them, so tones,
+ * pauses and timing changes follow each other without involving the caller.
+ * A #COMMAND_SET_TIMING lasts until tone_init() is next called, and a symbol length of 0 leaves
+ * the symbol length unchanged.
+ *
+ * \param commands The commands to execute.
+ * \param n Number of commands to execute.
+ * \return Whether the commands were accepted. If the global queue does not have room for
+ * all of them, none are executed or displayed.
+ */
+bool tone_play_commands(const Command *commands, size_t n);
+
+/**
+ * \brief Capacity (in markers) of the queue of markers reached by playback. This must be a power of 2.
+ */
+#define TONE_MARKER_QUEUE_N 8
+
+/**
+ * \brief Sets the function that is called when playback reaches a #COMMAND_MARKER.
+ *
+ * Markers are reached by whichever code executes the global queue: the playback interrupt handler,
+ * or the function which started playback. Either way they are only queued there, and the function
+ * is called later by tone_dispatch_markers(), with the command's #Command::marker.
+ * When #TONE_USE_DMA and #TONE_SAMPLE_RATE are set, markers are reached as samples are rendered,
+ * which is up to two DMA buffers ahead of the DAC output.
+ *
+ * \param callback The function to call, or NULL to ignore markers.
+ */
+void tone_set_marker_callback(void (*callback)(uint8_t));
+
+/**
+ * \brief Checks whether playback has reached markers which have not been dispatched yet.
+ *
+ * \return Whether tone_dispatch_markers() would call the marker callback.
+ */
+bool tone_marker_pending(void);
+
+/**
+ * \brief Passes every marker reached by playback to the callback set by tone_set_marker_callback(), oldest first.
+ *
+ * This is meant to be called from the main loop, whenever an interrupt wakes the CPU. Markers which
+ * are reached while #TONE_MARKER_QUEUE_N markers are waiting are dropped.
+ */
+void tone_dispatch_markers(void);
+
+#endif // TONE_H
@@ -0,0 +1,22 @@
+/*
+ * Minimal assertions for the host tests. A failed check is reported and counted, and the test
+ * carries on, so that main() can return the number of failures.
+ */
+#ifndef CHECK_H
+#define CHECK_H
+
+#include <stdio.h>
+
+static int check_failures;
+
+#define CHECK(COND) do { \
+	if (!(COND)) { \
+		fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #COND); \
+		check_failures++; \
+	} \
+} while (0)
+
+#define CHECK_DONE(NAME) \
+	(printf("%s: %s\n", (NAME), check_failures ? "FAILED" : "ok"), check_failures != 0)
+
+#endif // CHECK_H
@@ -0,0 +1,75 @@
+#include "fake_timer.h"
+#include <stddef.h>
+
+uint32_t SystemCoreClock = 120000000;
+uint32_t PeripheralClock = 60000000;
+
+//Converts a period in cpu cycles to a number of counter ticks, as in timer.c
+#define CYCLES_TO_TICKS(CYCLES) ((CYCLES) / (SystemCoreClock / PeripheralClock))
+
+static struct {
+	void (*callback)(void);
+	uint32_t deadline;
+	uint32_t period;        //Period in counter ticks, or 0 for a one-shot
+	int enabled;
+} channels[TIMER_MATCHES];
+
+static uint32_t counter;
+
+void timer_configure(void) {
+}
+
+uint32_t timer_now(void) {
+	return counter;
+}
+
+uint32_t timer_match_at(TimerMatch match, void (*callback)(void), uint32_t base, uint32_t delay, uint32_t period) {
+	channels[match].callback = callback;
+	channels[match].deadline = base + CYCLES_TO_TICKS(delay);
+	channels[match].period = CYCLES_TO_TICKS(period);
+	channels[match].enabled = 1;
+	return channels[match].deadline;
+}
+
+void timer_match_disable(TimerMatch match) {
+	channels[match].enabled = 0;
+}
+
+void fake_timer_stall(uint32_t ticks) {
+	counter += ticks;
+}
+
+void fake_timer_run(uint32_t ticks) {
+	uint32_t end = counter + ticks;
+	int match, next;
+	void (*callback)(void);
+
+	for (;;) {
+		// the channel whose deadline comes first, counting passed deadlines as due now.
+		next = -1;
+		for (match = 0; match < TIMER_MATCHES; match++) {
+			if (channels[match].enabled && (int32_t)(channels[match].deadline - end) <= 0 &&
+			    (next < 0 || (int32_t)(channels[match].deadline - channels[next].deadline) < 0)) {
+				next = match;
+			}
+		}
+		if (next < 0) {
+			break;
+		}
+
+		if ((int32_t)(channels[next].deadline - counter) > 0) {
+			counter = channels[next].deadline;
+		}
+		callback = channels[next].callback;
+		if (channels[next].period > 0) {
+			channels[next].deadline += channels[next].period;
+		} else {
+			channels[next].enabled = 0;
+		}
+		callback();
+	}
+
+	if ((int32_t)(end - counter) > 0) {
+		counter = end;
+	}
+}
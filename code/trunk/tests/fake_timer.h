@@ -0,0 +1,30 @@
+/*
+ * Host stand-in for drivers/timer.c, whose counter only moves when a test advances it.
+ */
+#ifndef FAKE_TIMER_H
+#define FAKE_TIMER_H
+
+#include <timer.h>
+
+/**
+ * \brief Number of counter ticks in 1 ms, as the counter runs at PCLK.
+ */
+#define FAKE_TICKS_PER_MS (PeripheralClock / 1000U)
+
+/**
+ * \brief Advances the counter, executing each match callback at its deadline.
+ *
+ * A deadline which has already passed when a channel is set fires at once, as on the hardware.
+ *
+ * \param ticks Number of counter ticks to advance by.
+ */
+void fake_timer_run(uint32_t ticks);
+
+/**
+ * \brief Advances the counter without executing callbacks, as if the code calling this were slow.
+ *
+ * \param ticks Number of counter ticks to advance by.
+ */
+void fake_timer_stall(uint32_t ticks);
+
+#endif // FAKE_TIMER_H
@@ -0,0 +1,53 @@
+/*
+ * Host stand-in for the LPC407x device header, used by the tests.
+ *
+ * The tests replace the drivers which touch peripherals, so only the core intrinsics are
+ * provided, along with the registers whose addresses are handed to the GPDMA. The intrinsics
+ * do nothing, as the tests run each interrupt handler to completion from the main thread.
+ */
+#ifndef LPC407x_8x_177x_8x_H
+#define LPC407x_8x_177x_8x_H
+
+#include <stdint.h>
+
+#define __I volatile const
+#define __O volatile
+#define __IO volatile
+#define __STATIC_INLINE static __inline__
+#define __INLINE __inline__
+
+typedef enum IRQn {
+	TIMER0_IRQn = 1,
+	TIMER1_IRQn,
+	TIMER2_IRQn,
+	TIMER3_IRQn,
+	GPIO_IRQn,
+	DMA_IRQn,
+	UART0_IRQn
+} IRQn_Type;
+
+typedef struct {
+	__IO uint32_t CR;
+	__IO uint32_t CTRL;
+	__IO uint32_t CNTVAL;
+} LPC_DAC_TypeDef;
+
+extern LPC_DAC_TypeDef fake_dac;
+#define LPC_DAC (&fake_dac)
+
+extern uint32_t SystemCoreClock;
+extern uint32_t PeripheralClock;
+
+__STATIC_INLINE void NVIC_SetPriority(IRQn_Type irq, uint32_t priority) { (void)irq; (void)priority; }
+__STATIC_INLINE void NVIC_EnableIRQ(IRQn_Type irq) { (void)irq; }
+__STATIC_INLINE void NVIC_DisableIRQ(IRQn_Type irq) { (void)irq; }
+__STATIC_INLINE void NVIC_ClearPendingIRQ(IRQn_Type irq) { (void)irq; }
+__STATIC_INLINE void NVIC_SetPendingIRQ(IRQn_Type irq) { (void)irq; }
+__STATIC_INLINE void __enable_irq(void) {}
+__STATIC_INLINE void __disable_irq(void) {}
+__STATIC_INLINE uint32_t __get_PRIMASK(void) { return 0; }
+__STATIC_INLINE void __set_PRIMASK(uint32_t primask) { (void)primask; }
+__STATIC_INLINE void __WFI(void) {}
+__STATIC_INLINE void __DMB(void) {}
+
+#endif // LPC407x_8x_177x_8x_H
@@ -0,0 +1,194 @@
+#include "check.h"
+#include "fake_timer.h"
+#include "keypad.h"
+#include "timer_wheel.h"
+#include <gpio.h>
+
+/*
+ * The keypad is modelled as a matrix of switches: a row reads low while a key of that row is
+ * down and its column is driven low. The interrupt line reads low while any row does.
+ */
+
+#define STEP_TICKS (FAKE_TICKS_PER_MS / 4)
+#define MAX_DRIVES 4096
+
+static uint16_t pressed;
+static int col_levels[KEYPAD_COLS];
+static TriggerMode trigger;
+static void (*interrupt_callback)(int);
+
+// times at which a single column was driven low, i.e. at which a step of the scan started.
+static uint32_t drive_times[MAX_DRIVES];
+static int drives;
+
+static KeyEvent events[64];
+static int n_events;
+
+// time at which the last call to run() started.
+static uint32_t run_start;
+
+void delay_us(unsigned int us) {
+	(void)us;
+}
+
+void gpio_set_mode(Pin pin, PinMode mode) {
+	(void)pin;
+	(void)mode;
+}
+
+void gpio_set_trigger(Pin pin, TriggerMode trig) {
+	(void)pin;
+	trigger = trig;
+}
+
+void gpio_set_callback(Pin pin, void (*callback)(int status)) {
+	(void)pin;
+	interrupt_callback = callback;
+}
+
+void gpio_set(Pin pin, int value) {
+	int col, low = 0;
+
+	for (col = 0; col < KEYPAD_COLS; col++) {
+		if (pin == colno_to_pin[col]) {
+			col_levels[col] = value;
+		}
+		low += !col_levels[col];
+	}
+	if (!value && low == 1 && drives < MAX_DRIVES) {
+		drive_times[drives++] = timer_now();
+	}
+}
+
+static int row_level(int row) {
+	int col;
+
+	for (col = 0; col < KEYPAD_COLS; col++) {
+		if ((pressed & KEY_BIT(row, col)) && !col_levels[col]) {
+			return 0;
+		}
+	}
+	return 1;
+}
+
+int gpio_get(Pin pin) {
+	int row;
+
+	for (row = 0; row < KEYPAD_ROWS; row++) {
+		if (pin == rowno_to_pin[row]) {
+			return row_level(row);
+		}
+	}
+	// the interrupt line
+	for (row = 0; row < KEYPAD_ROWS; row++) {
+		if (!row_level(row)) {
+			return 0;
+		}
+	}
+	return 1;
+}
+
+static void record_event(const KeyEvent *event) {
+	if (n_events < 64) {
+		events[n_events] = *event;
+	}
+	n_events++;
+}
+
+/*
+ * Runs the keypad for a while, with the keys down given for each quarter of a ms by \a keys.
+ */
+static void run(unsigned ms, uint16_t (*keys)(unsigned quarter)) {
+	unsigned quarter;
+	int line = gpio_get(P_INTERRUPT);
+
+	n_events = 0;
+	run_start = timer_now();
+	for (quarter = 0; quarter < ms * 4; quarter++) {
+		pressed = keys(quarter);
+		if (trigger == Falling && line && !gpio_get(P_INTERRUPT)) {
+			interrupt_callback(1 << GET_PIN_INDEX(P_INTERRUPT));
+		}
+		line = gpio_get(P_INTERRUPT);
+		fake_timer_run(STEP_TICKS);
+		keypad_dispatch_events();
+	}
+}
+
+static uint16_t long_press(unsigned quarter) {
+	return quarter >= 400 && quarter < 8400 ? KEY_BIT(1, 2) : 0;
+}
+
+/*
+ * While a key is held for 2 s, the scan must take one step per ms, never several in one tick.
+ */
+static void test_scan_pacing(void) {
+	int i;
+
+	drives = 0;
+	run(3000, long_press);
+
+	CHECK(drives > 1900 && drives < 2100);
+	for (i = 1; i < drives; i++) {
+		CHECK(drive_times[i] - drive_times[i - 1] >= FAKE_TICKS_PER_MS);
+	}
+	CHECK(n_events == 3);
+	CHECK(events[0].type == KEY_PRESS && events[0].row == 1 && events[0].col == 2);
+	CHECK(events[1].type == KEY_HOLD);
+	CHECK(events[2].type == KEY_RELEASE && events[2].keys == 0);
+	CHECK(trigger == Falling);
+
+	// the hold is timed from the press, whatever the pace of the scan.
+	CHECK(events[1].time - events[0].time >= PERIOD_MS_TO_TICKS(KEYPAD_HOLD_MS));
+	CHECK(events[1].time - events[0].time <= PERIOD_MS_TO_TICKS(KEYPAD_HOLD_MS + 4));
+}
+
+static uint16_t glitch(unsigned quarter) {
+	return quarter >= 400 && quarter < 412 ? KEY_BIT(0, 0) : 0;
+}
+
+// contact bounces for 6 ms on press and on release.
+static uint16_t bouncy_press(unsigned quarter) {
+	if (quarter >= 400 && quarter < 424) {
+		return quarter & 2 ? KEY_BIT(3, 1) : 0;
+	}
+	if (quarter >= 424 && quarter < 1200) {
+		return KEY_BIT(3, 1);
+	}
+	if (quarter >= 1200 && quarter < 1224) {
+		return quarter & 2 ? 0 : KEY_BIT(3, 1);
+	}
+	return 0;
+}
+
+/*
+ * Contacts shorter than #KEYPAD_DEBOUNCE_MS are ignored, and bounces produce a single press and
+ * release, no sooner than #KEYPAD_DEBOUNCE_MS after the first contact.
+ */
+static void test_debounce(void) {
+	uint32_t contact;
+
+	run(500, glitch);
+	CHECK(n_events == 0);
+	CHECK(trigger == Falling);
+
+	run(500, bouncy_press);
+	contact = run_start + 100 * FAKE_TICKS_PER_MS;
+	CHECK(n_events == 2);
+	CHECK(events[0].type == KEY_PRESS && events[0].row == 3 && events[0].col == 1);
+	CHECK(events[0].time - contact >= PERIOD_MS_TO_TICKS(KEYPAD_DEBOUNCE_MS));
+	CHECK(events[0].time - contact <= PERIOD_MS_TO_TICKS(KEYPAD_DEBOUNCE_MS + 10));
+	CHECK(events[1].type == KEY_RELEASE);
+	CHECK(trigger == Falling);
+}
+
+int main(void) {
+	timer_wheel_init();
+	keypad_init();
+	keypad_set_event_callback(record_event);
+
+	test_scan_pacing();
+	test_debounce();
+
+	return CHECK_DONE("test_keypad");
+}
@@ -0,0 +1,147 @@
+#include "check.h"
+#include "fake_timer.h"
+#include "lcd.h"
+#include "timer_wheel.h"
+#include <gpio.h>
+#include <string.h>
+
+/*
+ * The serial expander and the HD44780 controller behind it are modelled from the pins: bits are
+ * shifted in on SCK, latched on RCK, and a nibble is taken by the controller when E falls.
+ */
+
+// expander outputs, as mapped in lcd.c
+#define OUT_DATA 0x0F
+#define OUT_RS 0x10
+#define OUT_E 0x20
+
+static int ser, sck, rck;
+static uint8_t shift_register, outputs;
+static int nibble_pending;
+static uint8_t high_nibble;
+
+static char ddram[0x80];
+static int address;
+static int cursor_on;
+static int bytes;
+static int delays;
+
+void delay_us(unsigned int us) {
+	(void)us;
+	delays++;
+}
+
+void gpio_set_mode(Pin pin, PinMode mode) {
+	(void)pin;
+	(void)mode;
+}
+
+static void controller_write(int rs, uint8_t byte) {
+	bytes++;
+	if (rs) {
+		ddram[address] = byte;
+		address = (address + 1) & 0x7F;
+	} else if (byte & 0x80) {
+		address = byte & 0x7F;
+	} else if (byte == 0x01) {
+		memset(ddram, ' ', sizeof(ddram));
+		address = 0;
+	} else if ((byte & 0xF8) == 0x08) {
+		cursor_on = !!(byte & 0x02);
+	}
+}
+
+static void latch(uint8_t latched) {
+	if ((outputs & OUT_E) && !(latched & OUT_E)) {
+		if (!nibble_pending) {
+			high_nibble = outputs & OUT_DATA;
+		} else {
+			controller_write(outputs & OUT_RS, (uint8_t)((high_nibble << 4) | (outputs & OUT_DATA)));
+		}
+		nibble_pending = !nibble_pending;
+	}
+	outputs = latched;
+}
+
+void gpio_set(Pin pin, int value) {
+	if (pin == P1_24) {
+		ser = value;
+	} else if (pin == P1_20) {
+		if (value && !sck) {
+			shift_register = (uint8_t)((shift_register << 1) | ser);
+		}
+		sck = value;
+	} else if (pin == P1_2) {
+		if (value && !rck) {
+			latch(shift_register);
+		}
+		rck = value;
+	}
+}
+
+static int row_is(int row, const char *text) {
+	char expected[16];
+
+	memset(expected, ' ', sizeof(expected));
+	memcpy(expected, text, strlen(text));
+	return memcmp(&ddram[row * 0x40], expected, sizeof(expected)) == 0;
+}
+
+/*
+ * Writes to the display return without touching the bus, and are sent one command per tick.
+ */
+static void test_paced_writes(void) {
+	int ms, busiest = 0;
+
+	bytes = 0;
+	delays = 0;
+	lcd_clear();
+	lcd_print("1:KEYPD 2:QCKDL");
+	lcd_set_cursor(0, 1);
+	lcd_print("3:SETTINGS");
+	CHECK(bytes == 0);
+
+	for (ms = 0; ms < 100; ms++) {
+		bytes = 0;
+		fake_timer_run(FAKE_TICKS_PER_MS);
+		if (bytes > busiest) {
+			busiest = bytes;
+		}
+	}
+	CHECK(busiest == 1);
+	CHECK(row_is(0, "1:KEYPD 2:QCKDL"));
+	CHECK(row_is(1, "3:SETTINGS"));
+	CHECK(delays == 0);
+}
+
+/*
+ * Only the cells which change are sent, and the cursor ends up where the next character goes.
+ */
+static void test_partial_update(void) {
+	int total = 0, ms;
+
+	lcd_set_cursor(0, 0);
+	lcd_print("ISS (ms): ");
+	lcd_set_cursor_visibile(1);
+	lcd_set_cursor(10, 0);
+	for (ms = 0; ms < 100; ms++) {
+		bytes = 0;
+		fake_timer_run(FAKE_TICKS_PER_MS);
+		CHECK(bytes <= 1);
+		total += bytes;
+	}
+	CHECK(row_is(0, "ISS (ms): QCKDL"));
+	CHECK(cursor_on && address == 10);
+	CHECK(total < 16);
+}
+
+int main(void) {
+	timer_wheel_init();
+	lcd_init();
+	CHECK(row_is(0, "") && row_is(1, ""));
+
+	test_paced_writes();
+	test_partial_update();
+
+	return CHECK_DONE("test_lcd");
+}
@@ -0,0 +1,161 @@
+/*
+ * Stress test and throughput benchmark of the single-producer queue, with the producer and the
+ * consumer on two threads. Every command carries its position in the stream, so the consumer
+ * can check that commands come out whole, and in the order they went in.
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include "check.h"
+#include "queue.h"
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define TEST_NAME "test_queue_c11"
+#else
+#define TEST_NAME "test_queue_gnu89"
+#endif
+
+#define COMMANDS 16000000UL
+
+/**
+ * \brief Largest number of commands appended at once.
+ */
+#define BATCH 24
+
+/**
+ * \brief Works out the command at a position of the stream.
+ *
+ * Positions alternate between runs of plain tones, which the producer appends as sequences of
+ * symbols, and runs of every kind of command.
+ */
+static void expected_command(unsigned long position, Command *command) {
+	memset(command, 0, sizeof(*command));
+	if ((position / 64) % 2 == 0) {
+		command->type = COMMAND_TONE;
+		command->symbol = position & 0xF;
+		return;
+	}
+	switch (position % 5) {
+		case 0:
+			command->type = COMMAND_TONE;
+			command->symbol = (position >> 4) & 0xF;
+			command->length = position & 0xFFFF;
+			if (command->length == 0) {
+				command->length = 1;
+			}
+			break;
+		case 1:
+			command->type = COMMAND_SILENCE;
+			command->length = position & 0xFFFF;
+			break;
+		case 2:
+			command->type = COMMAND_SET_TIMING;
+			command->length = position & 0xFFFF;
+			command->spacing = (position >> 16) & 0xFFFF;
+			break;
+		case 3:
+			command->type = COMMAND_MARKER;
+			command->marker = position & 0xFF;
+			break;
+		default:
+			command->type = COMMAND_TONE;
+			command->symbol = position & 0xF;
+			break;
+	}
+}
+
+static int same_command(const Command *a, const Command *b) {
+	return a->type == b->type && a->symbol == b->symbol && a->marker == b->marker &&
+	       a->length == b->length && a->spacing == b->spacing;
+}
+
+static unsigned long rejected;
+
+static void *producer(void *unused) {
+	Command batch[BATCH];
+	uint8_t symbols[BATCH];
+	unsigned long position = 0, seed = 1;
+	size_t n, i;
+	int plain;
+
+	(void)unused;
+	while (position < COMMANDS) {
+		seed = seed * 1103515245UL + 12345UL;
+		n = 1 + (seed >> 16) % BATCH;
+		if (n > COMMANDS - position) {
+			n = COMMANDS - position;
+		}
+		// a batch does not straddle two runs, so that it is either all plain tones or not.
+		if (n > 64 - position % 64) {
+			n = 64 - position % 64;
+		}
+
+		plain = 1;
+		for (i = 0; i < n; i++) {
+			expected_command(position + i, &batch[i]);
+			symbols[i] = batch[i].symbol;
+			plain = plain && batch[i].type == COMMAND_TONE && batch[i].length == 0;
+		}
+
+		while (!(plain ? (n == 1 ? enqueue(symbols[0]) : enqueue_sequence(symbols, n))
+		               : enqueue_commands(batch, n))) {
+			rejected++;
+			sched_yield();
+		}
+		position += n;
+	}
+	return NULL;
+}
+
+static unsigned long mismatches;
+
+static void *consumer(void *unused) {
+	Command command, expected;
+	unsigned long position = 0;
+
+	(void)unused;
+	while (position < COMMANDS) {
+		if (!dequeue_command(&command)) {
+			sched_yield();
+			continue;
+		}
+		expected_command(position, &expected);
+		if (!same_command(&command, &expected) && mismatches++ < 5) {
+			fprintf(stderr, "command %lu: got type %d symbol %u length %u, expected type %d symbol %u length %u\n",
+			        position, command.type, command.symbol, command.length,
+			        expected.type, expected.symbol, expected.length);
+		}
+		position++;
+	}
+	return NULL;
+}
+
+int main(void) {
+	pthread_t producer_thread, consumer_thread;
+	struct timespec start, end;
+	double seconds;
+	Command command;
+	QueueStats stats;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	CHECK(pthread_create(&consumer_thread, NULL, consumer, NULL) == 0);
+	CHECK(pthread_create(&producer_thread, NULL, producer, NULL) == 0);
+	pthread_join(producer_thread, NULL);
+	pthread_join(consumer_thread, NULL);
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	CHECK(mismatches == 0);
+	CHECK(!dequeue_command(&command));
+	queue_get_stats(&stats);
+	CHECK(stats.drops >= rejected);
+	CHECK(stats.high_watermark <= QUEUE_N);
+
+	seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+	printf("%lu commands in %.3f s (%.1f M/s), %lu batches rejected while full\n",
+	       COMMANDS, seconds, COMMANDS / seconds / 1e6, rejected);
+
+	return CHECK_DONE(TEST_NAME);
+}
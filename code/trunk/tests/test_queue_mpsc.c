@@ -0,0 +1,134 @@
+/*
+ * Stress test of the multi-producer queue, with several producer threads and one consumer thread.
+ * Every command carries its producer and its position in that producer's stream, so the consumer
+ * can check that each producer's commands come out in order, and that none is lost or repeated.
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include "check.h"
+#include "queue.h"
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+#if !QUEUE_MPSC
+#error "build with -DQUEUE_MPSC=1"
+#endif
+
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define TEST_NAME "test_queue_mpsc_c11"
+#else
+#define TEST_NAME "test_queue_mpsc_gnu89"
+#endif
+
+#define PRODUCERS 4
+#define COMMANDS_PER_PRODUCER 2000000UL
+
+/**
+ * \brief Largest number of commands appended at once.
+ */
+#define BATCH 16
+
+/*
+ * The producer goes in #Command::marker, and the position in #Command::length (low half) and
+ * #Command::spacing (high half).
+ */
+static void make_command(int producer, unsigned long position, Command *command) {
+	command->type = COMMAND_SET_TIMING;
+	command->symbol = position & 0xF;
+	command->marker = producer;
+	command->length = position & 0xFFFF;
+	command->spacing = (position >> 16) & 0xFFFF;
+}
+
+static unsigned long rejected[PRODUCERS];
+
+static void *producer(void *arg) {
+	int id = (int)(size_t)arg;
+	Command batch[BATCH];
+	unsigned long position = 0, seed = id + 1;
+	size_t n, i;
+
+	while (position < COMMANDS_PER_PRODUCER) {
+		seed = seed * 1103515245UL + 12345UL;
+		n = 1 + (seed >> 16) % BATCH;
+		if (n > COMMANDS_PER_PRODUCER - position) {
+			n = COMMANDS_PER_PRODUCER - position;
+		}
+		for (i = 0; i < n; i++) {
+			make_command(id, position + i, &batch[i]);
+		}
+		while (!enqueue_commands(batch, n)) {
+			rejected[id]++;
+			sched_yield();
+		}
+		position += n;
+	}
+	return NULL;
+}
+
+static unsigned long received[PRODUCERS];
+static unsigned long errors;
+
+static void *consumer(void *unused) {
+	Command command, expected;
+	unsigned long total = 0;
+
+	(void)unused;
+	while (total < PRODUCERS * COMMANDS_PER_PRODUCER) {
+		if (!dequeue_command(&command)) {
+			sched_yield();
+			continue;
+		}
+		total++;
+		if (command.marker >= PRODUCERS) {
+			errors++;
+			continue;
+		}
+		make_command(command.marker, received[command.marker], &expected);
+		if ((command.type != expected.type || command.symbol != expected.symbol ||
+		     command.length != expected.length || command.spacing != expected.spacing) && errors++ < 5) {
+			fprintf(stderr, "producer %u: got position %lu, expected %lu\n", command.marker,
+			        ((unsigned long)command.spacing << 16) | command.length, received[command.marker]);
+		}
+		received[command.marker]++;
+	}
+	return NULL;
+}
+
+int main(void) {
+	pthread_t producers[PRODUCERS], consumer_thread;
+	struct timespec start, end;
+	unsigned long total_rejected = 0;
+	double seconds;
+	Command command;
+	QueueStats stats;
+	int i;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	CHECK(pthread_create(&consumer_thread, NULL, consumer, NULL) == 0);
+	for (i = 0; i < PRODUCERS; i++) {
+		CHECK(pthread_create(&producers[i], NULL, producer, (void *)(size_t)i) == 0);
+	}
+	for (i = 0; i < PRODUCERS; i++) {
+		pthread_join(producers[i], NULL);
+		total_rejected += rejected[i];
+	}
+	pthread_join(consumer_thread, NULL);
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	CHECK(errors == 0);
+	for (i = 0; i < PRODUCERS; i++) {
+		CHECK(received[i] == COMMANDS_PER_PRODUCER);
+	}
+	CHECK(!dequeue_command(&command));
+	queue_get_stats(&stats);
+	CHECK(stats.drops >= total_rejected);
+
+	seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+	printf("%d producers, %lu commands in %.3f s (%.1f M/s), %lu batches rejected while full\n",
+	       PRODUCERS, PRODUCERS * COMMANDS_PER_PRODUCER, seconds,
+	       PRODUCERS * COMMANDS_PER_PRODUCER / seconds / 1e6, total_rejected);
+
+	return CHECK_DONE(TEST_NAME);
+}
@@ -0,0 +1,100 @@
+#include "check.h"
+#include "fake_timer.h"
+#include "timer_wheel.h"
+#include <stdlib.h>
+
+#define MAX_FIRES 64
+
+static SoftTimer repeating;
+static SoftTimer other;
+static unsigned repeat_delay;
+static uint32_t fire_times[MAX_FIRES];
+static int fires;
+
+static void repeat(void) {
+	fire_times[fires++] = timer_now();
+	// stop after a while, so that a timer expiring again within its tick cannot hang the test.
+	if (fires < MAX_FIRES) {
+		timer_wheel_schedule(&repeating, repeat, repeat_delay);
+	}
+}
+
+static void nothing(void) {
+}
+
+/*
+ * A timer rescheduled from its own callback must expire once per delay, whether or not it is the
+ * only pending timer, rather than again within the tick which is being processed.
+ */
+static void test_reschedule(unsigned delay, int alone) {
+	int i;
+
+	fires = 0;
+	repeat_delay = delay;
+	if (!alone) {
+		timer_wheel_schedule(&other, nothing, 100000);
+	}
+	timer_wheel_schedule(&repeating, repeat, delay);
+	fake_timer_run(50 * delay * FAKE_TICKS_PER_MS);
+	timer_wheel_cancel(&repeating);
+	timer_wheel_cancel(&other);
+
+	CHECK(fires >= 49 && fires <= 50);
+	for (i = 1; i < fires; i++) {
+		CHECK(fire_times[i] - fire_times[i - 1] == delay * FAKE_TICKS_PER_MS);
+	}
+}
+
+#define STRESS_TIMERS 256
+#define STRESS_MS 300000
+
+static SoftTimer timers[STRESS_TIMERS];
+static uint32_t due[STRESS_TIMERS];
+
+/*
+ * Random schedules and cancels, checking that every timer expires within a tick of its delay.
+ */
+static void test_stress(void) {
+	static int pending[STRESS_TIMERS];
+	uint32_t now, delay;
+	int i, fired = 0;
+
+	// counted separately, as the hardware counter wraps around every 71.6 s.
+	srand(1);
+	for (now = 0; now < STRESS_MS; ) {
+		if (rand() % 50 == 0) {
+			i = rand() % STRESS_TIMERS;
+			delay = rand() % 4 == 0 ? (uint32_t)rand() % 400000 : (uint32_t)rand() % 1000;
+			timer_wheel_schedule(&timers[i], nothing, delay);
+			due[i] = now + (delay ? delay : 1);
+		}
+		if (rand() % 200 == 0) {
+			timer_wheel_cancel(&timers[rand() % STRESS_TIMERS]);
+		}
+
+		for (i = 0; i < STRESS_TIMERS; i++) {
+			pending[i] = timer_wheel_pending(&timers[i]);
+		}
+		fake_timer_run(FAKE_TICKS_PER_MS);
+		now++;
+		for (i = 0; i < STRESS_TIMERS; i++) {
+			if (pending[i] && !timer_wheel_pending(&timers[i])) {
+				fired++;
+				CHECK((int32_t)(now - due[i]) >= 0 && (int32_t)(now - due[i]) <= 1);
+			}
+		}
+	}
+	CHECK(fired > 3000);
+}
+
+int main(void) {
+	timer_wheel_init();
+
+	test_reschedule(1, 1);
+	test_reschedule(1, 0);
+	test_reschedule(3, 1);
+	test_reschedule(3, 0);
+	test_stress();
+
+	return CHECK_DONE("test_timer_wheel");
+}
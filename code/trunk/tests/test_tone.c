@@ -0,0 +1,254 @@
+#include "check.h"
+#include "fake_timer.h"
+#include "tone.h"
+#include "queue.h"
+#include "settings.h"
+#include <dac.h>
+#include <dma.h>
+#include <gpio.h>
+#include <platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * The GPDMA channel is modelled as on the hardware: once a transfer completes, the channel loads
+ * its next linked list item (or stops if there is none), and only then raises the interrupt.
+ * Every transfer is taken to be one DAC sample. Markers are dispatched after every interrupt, as
+ * the main loop does.
+ */
+
+#define SILENCE ((DAC_MASK + 1) >> 1)
+
+// rate (in Hz) of SILENCE_SAMPLE_RATE in tone.c, at which a silence is streamed.
+#define SILENCE_RATE 1000
+
+LPC_DAC_TypeDef fake_dac;
+Settings settings;
+
+static struct {
+	uint32_t *src;
+	unsigned size;
+	DmaLli *next;
+	int enabled;
+} channel;
+
+static void (*dma_callback)(void);
+static uint32_t dac_period;
+
+static unsigned samples, tone_samples, streams;
+static uint8_t last_marker;
+static unsigned marker_samples;
+
+void gpio_set_mode(Pin pin, PinMode mode) {
+	(void)pin;
+	(void)mode;
+}
+
+void lcd_put_char(char c) {
+	(void)c;
+}
+
+void dac_init(void) {
+}
+
+void dac_set(uint16_t value) {
+	fake_dac.CR = DAC_VALUE(value);
+}
+
+void dac_dma_enable(uint32_t period) {
+	dac_period = period;
+	streams++;
+}
+
+void dac_dma_disable(void) {
+	dac_period = 0;
+}
+
+void dma_init(void) {
+}
+
+void dma_set_callback(void (*callback)(void)) {
+	dma_callback = callback;
+}
+
+void dma_setup(char ChannelNum, unsigned int SrcMemAddr, unsigned int DstMemAddr, unsigned int SrcPeriph,
+               unsigned int DstPeriph, unsigned int TransferSize, unsigned int BurstSize,
+               unsigned int TransferWidth, unsigned int TransferType, unsigned int Dmalli) {
+	(void)ChannelNum; (void)DstMemAddr; (void)SrcPeriph; (void)DstPeriph;
+	(void)BurstSize; (void)TransferWidth; (void)TransferType;
+	channel.src = (uint32_t *)(uintptr_t)SrcMemAddr;
+	channel.size = TransferSize;
+	channel.next = (DmaLli *)(uintptr_t)Dmalli;
+}
+
+void dma_link(unsigned char ChannelNum, DmaLli *lli, unsigned int SrcMemAddr, unsigned int DstMemAddr,
+              DmaLli *next) {
+	(void)ChannelNum;
+	lli->SrcAddr = SrcMemAddr;
+	lli->DstAddr = DstMemAddr;
+	lli->Next = next;
+	lli->Control = DMA_BUFFER_SIZE;
+}
+
+void dma_link_transfersize(DmaLli *lli, unsigned int size) {
+	lli->Control = size;
+}
+
+void dma_transfersize(unsigned char ChannelNum, unsigned int size) {
+	(void)ChannelNum;
+	channel.size = size;
+}
+
+void dma_next_lli(unsigned char ChannelNum, DmaLli *lli) {
+	(void)ChannelNum;
+	channel.next = lli;
+}
+
+void dma_enable(unsigned char ChannelNum) {
+	(void)ChannelNum;
+	channel.enabled = 1;
+}
+
+void dma_disable(unsigned char ChannelNum) {
+	(void)ChannelNum;
+	channel.enabled = 0;
+}
+
+static void marker_reached(uint8_t marker) {
+	last_marker = marker;
+	marker_samples = samples;
+}
+
+/*
+ * Plays transfers until the channel stops and is not restarted by its interrupt.
+ */
+static void run(void) {
+	unsigned i;
+	int transfers = 0;
+
+	while (channel.enabled && transfers++ < 100000) {
+		CHECK(dac_period != 0);
+		for (i = 0; i < channel.size; i++) {
+			fake_dac.CR = channel.src[i];
+			samples++;
+			if (((fake_dac.CR >> 6) & DAC_MASK) != SILENCE) {
+				tone_samples++;
+			}
+		}
+		if (channel.next == NULL) {
+			channel.enabled = 0;
+		} else {
+			channel.src = (uint32_t *)(uintptr_t)channel.next->SrcAddr;
+			channel.size = channel.next->Control;
+			channel.next = channel.next->Next;
+		}
+		dma_callback();
+		tone_dispatch_markers();
+	}
+	CHECK(!channel.enabled);
+}
+
+static void reset(void) {
+	samples = 0;
+	tone_samples = 0;
+	streams = 0;
+	last_marker = 0;
+	marker_samples = 0;
+}
+
+/*
+ * Plays a silence followed by a marker, and checks that exactly its samples were played.
+ */
+static void check_silence(unsigned length, unsigned slack) {
+	Command commands[2] = {{COMMAND_SILENCE, 0, 0, 0, 0}, {COMMAND_MARKER, 0, 1, 0, 0}};
+	unsigned expected = SILENCE_RATE * length / 1000U;
+
+	commands[0].length = (uint16_t)length;
+	reset();
+	CHECK(tone_play_commands(commands, 2));
+	run();
+	CHECK(streams == 1);
+	CHECK(tone_samples == 0);
+	CHECK(samples >= expected && samples <= expected + slack);
+	CHECK(last_marker == 1 && marker_samples == samples);
+	CHECK(dac_period == 0);
+}
+
+/*
+ * A stream which fills exactly one buffer ends after it, whatever stream was played before.
+ */
+static void test_one_buffer(void) {
+	unsigned length = DMA_BUFFER_SIZE * 1000U / SILENCE_RATE;
+
+	check_silence(length, 0);
+	check_silence(length / 2, 0);
+	check_silence(length, 0);
+}
+
+/*
+ * A stream which ends exactly at the end of its second buffer is followed by at most one silent sample,
+ * which the channel had to load before the end was known.
+ */
+static void test_buffer_boundaries(void) {
+	unsigned length = DMA_BUFFER_SIZE * 1000U / SILENCE_RATE;
+
+	check_silence(2 * length, 1);
+	check_silence(3 * length, 1);
+	check_silence(length + 1, 0);
+	check_silence(1, 0);
+}
+
+/*
+ * A tone is played for its length at its own rate, followed by the inter-symbol spacing.
+ */
+static void test_tone(void) {
+	Command commands[3] = {
+		{COMMAND_SET_TIMING, 0, 0, 100, 20},
+		{COMMAND_TONE, 5, 0, 0, 0},
+		{COMMAND_MARKER, 0, 2, 0, 0}
+	};
+	unsigned rate, tone, gap;
+
+	reset();
+	CHECK(tone_play_commands(commands, 3));
+	rate = PeripheralClock / dac_period;
+	tone = rate * 100 / 1000U;
+	gap = rate * 20 / 1000U;
+	run();
+	CHECK(streams == 1);
+	CHECK(tone_samples > tone - tone / 8 && tone_samples <= tone);
+	CHECK(samples >= tone + gap && samples <= tone + gap + 1);
+	CHECK(last_marker == 2);
+}
+
+/*
+ * A marker reached by the function which starts playback is only reported once it is dispatched.
+ */
+static void test_leading_marker(void) {
+	Command commands[2] = {{COMMAND_MARKER, 0, 3, 0, 0}, {COMMAND_SILENCE, 0, 0, 10, 0}};
+
+	reset();
+	CHECK(tone_play_commands(commands, 2));
+	CHECK(last_marker == 0);
+	CHECK(tone_marker_pending());
+	tone_dispatch_markers();
+	CHECK(last_marker == 3 && marker_samples == 0);
+	CHECK(!tone_marker_pending());
+	run();
+	CHECK(samples == 10 * SILENCE_RATE / 1000U);
+}
+
+int main(void) {
+	settings.symbol_length = 100;
+	settings.inter_symbol_spacing = 20;
+	settings.lut_logsize = 9;
+	tone_init();
+	tone_set_marker_callback(marker_reached);
+
+	test_one_buffer();
+	test_buffer_boundaries();
+	test_tone();
+	test_leading_marker();
+
+	return CHECK_DONE("test_tone");
+}
@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+"""Generates src/sine_tables.c, the sine look-up tables used for tone generation.
+
+One table is generated for every LUT size between MIN_LUT_LOGSIZE and MAX_LUT_LOGSIZE
+(as defined in src/settings.h), so that the firmware never has to compute sines at run time.
+Only the first quarter of each period is stored (including its end point), as signed 16-bit
+values with a peak of SINE_AMPLITUDE (as defined in src/sine_tables.h); the firmware recovers
+the other three quarters by symmetry. No other header is read.
+
+This is run by the Keil project before every build, and only rewrites the output if it changed.
+It can also be run by hand from any directory.
+"""
+import math
+import os
+import re
+
+TRUNK = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SETTINGS_H = os.path.join(TRUNK, 'src', 'settings.h')
+SINE_TABLES_H = os.path.join(TRUNK, 'src', 'sine_tables.h')
+OUTPUT = os.path.join(TRUNK, 'src', 'sine_tables.c')
+
+# Number of table entries written per line of output.
+ENTRIES_PER_LINE = 12
+
+
+def read_define(path, name):
+    """Reads the integer value of a simple #define from a header file."""
+    with open(path, encoding='latin-1') as f:
+        match = re.search(r'^#define\s+%s\s+(\d+)' % name, f.read(), re.MULTILINE)
+    if match is None:
+        raise SystemExit('%s: could not find #define %s' % (path, name))
+    return int(match.group(1))
+
+
+def table(logsize, amplitude):
+    """Returns the first quarter period of a sine wave sampled at 2^logsize points per period."""
+    quarter = 1 << (logsize - 2)
+    return [int(round(amplitude * math.sin(n * math.pi / 2 / quarter))) for n in range(quarter + 1)]
+
+
+def generate():
+    min_logsize = read_define(SETTINGS_H, 'MIN_LUT_LOGSIZE')
+    max_logsize = read_define(SETTINGS_H, 'MAX_LUT_LOGSIZE')
+    amplitude = read_define(SINE_TABLES_H, 'SINE_AMPLITUDE')
+
+    lines = [
+        '/* Generated by tools/gen_sine_tables.py -- do not edit. */',
+        '#include "sine_tables.h"',
+        '#include "settings.h"',
+        '#include <stddef.h>',
+        '',
+        '#if MIN_LUT_LOGSIZE != %d || MAX_LUT_LOGSIZE != %d || SINE_AMPLITUDE != %d' % (min_logsize, max_logsize, amplitude),
+        '#error "sine_tables.c is out of date, run tools/gen_sine_tables.py"',
+        '#endif',
+        '',
+    ]
+    for logsize in range(min_logsize, max_logsize + 1):
+        values = table(logsize, amplitude)
+        lines.append('static const int16_t sine_table_%d[%d] = {' % (logsize, len(values)))
+        for i in range(0, len(values), ENTRIES_PER_LINE):
+            lines.append('\t' + ', '.join(str(v) for v in values[i:i + ENTRIES_PER_LINE]) + ',')
+        lines.append('};')
+        lines.append('')
+
+    lines.append('const int16_t * const sine_tables[MAX_LUT_LOGSIZE + 1] = {')
+    for logsize in range(0, max_logsize + 1):
+        if logsize < min_logsize:
+            lines.append('\tNULL,')
+        else:
+            lines.append('\tsine_table_%d,' % logsize)
+    lines.append('};')
+    return '\r\n'.join(lines) + '\r\n'
+
+
+def main():
+    contents = generate()
+    try:
+        with open(OUTPUT, newline='') as f:
+            if f.read() == contents:
+                return
+    except FileNotFoundError:
+        pass
+    with open(OUTPUT, 'w', newline='') as f:
+        f.write(contents)
+
+
+if __name__ == '__main__':
+    main()